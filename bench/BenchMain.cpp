@@ -0,0 +1,34 @@
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <cstdio>
+
+#include "Benchmarks.h"
+
+int main (int argc, char* argv[])
+{
+    // The processor's parameter state expects a message manager to exist.
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    const juce::String mode = argc > 1 ? juce::String(argv[1]) : juce::String("processblock");
+
+    if (mode == "processblock")
+        return runProcessBlockBench();
+
+    if (mode == "state")
+        return runStateBench();
+
+    if (mode == "trackswitch")
+        return runTrackSwitchBench();
+
+    if (mode == "editor")
+        return runEditorStartupBench();
+
+    if (mode == "midiorder")
+        return runMidiOrderCheck();
+
+    if (mode == "lfo")
+        return runLfoCheck();
+
+    std::fprintf(stderr, "usage: modelCycles_bench [processblock | state | trackswitch | editor | midiorder | lfo]\n");
+    return 1;
+}
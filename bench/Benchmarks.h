@@ -0,0 +1,9 @@
+#pragma once
+
+// Benchmark modes of modelCycles_bench (see BenchMain.cpp). Each returns a process exit code.
+int runProcessBlockBench();
+int runStateBench();
+int runTrackSwitchBench();
+int runEditorStartupBench();
+int runMidiOrderCheck();
+int runLfoCheck();
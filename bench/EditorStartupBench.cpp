@@ -0,0 +1,122 @@
+// Editor startup cost ("editor" mode): time from createEditor() to the end of its first paint,
+// split into construction and the first full paint (rendered into an image, so no window or
+// display is needed), plus what each open editor costs in components and resident memory.
+// The first editor of the process also pays for one-time work such as font resolution and
+// artwork parsing, so it is reported separately from the mean of later editors.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#if JUCE_LINUX
+ #include <fstream>
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+#include "../source/PluginProcessor.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    constexpr int iterations = 20;
+
+    struct Timing
+    {
+        double constructMs { 0.0 };
+        double firstPaintMs { 0.0 };
+    };
+
+    double millisecondsSince (juce::int64 startTicks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1.0e3;
+    }
+
+    // Resident set size of the process, or 0 where the platform isn't handled.
+    juce::int64 residentBytes()
+    {
+       #if JUCE_LINUX
+        std::ifstream statm ("/proc/self/statm");
+        long long sizePages = 0, residentPages = 0;
+        if (statm >> sizePages >> residentPages)
+            return (juce::int64) residentPages * (juce::int64) sysconf(_SC_PAGESIZE);
+       #elif JUCE_MAC
+        mach_task_basic_info_data_t info {};
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) == KERN_SUCCESS)
+            return (juce::int64) info.resident_size;
+       #endif
+        return 0;
+    }
+
+    int countComponents (const juce::Component& c)
+    {
+        int n = 1;
+        for (auto* child : c.getChildren())
+            n += countComponents(*child);
+        return n;
+    }
+
+    std::unique_ptr<juce::AudioProcessorEditor> openEditor (PluginProcessor& processor, Timing& timing)
+    {
+        auto start = juce::Time::getHighResolutionTicks();
+        std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+        timing.constructMs = millisecondsSince(start);
+
+        start = juce::Time::getHighResolutionTicks();
+        const auto snapshot = editor->createComponentSnapshot(editor->getLocalBounds());
+        timing.firstPaintMs = millisecondsSince(start);
+
+        juce::ignoreUnused(snapshot);
+        return editor;
+    }
+
+    void report (const char* name, const Timing& t, int components, juce::int64 bytes)
+    {
+        std::printf("%-8s %14.2f %14.2f %14.2f %12d", name, t.constructMs, t.firstPaintMs,
+                    t.constructMs + t.firstPaintMs, components);
+
+        if (bytes > 0)
+            std::printf(" %12.1f\n", (double) bytes / 1024.0);
+        else
+            std::printf(" %12s\n", "n/a");
+    }
+}
+
+int runEditorStartupBench()
+{
+    PluginProcessor processor;
+
+    std::printf("editor: first editor of the process, then mean of %d more (kept open together)\n\n", iterations);
+    std::printf("%-8s %14s %14s %14s %12s %12s\n", "editor", "construct ms", "first paint ms", "total ms",
+                "components", "RSS KiB");
+
+    {
+        Timing first;
+        const auto before = residentBytes();
+        auto editor = openEditor(processor, first);
+        const auto after = residentBytes();
+        report("first", first, countComponents(*editor), before > 0 ? after - before : 0);
+    }
+
+    // Later editors stay open until all are measured, so freed memory isn't simply reused and the
+    // RSS growth per editor is what each one really holds.
+    std::vector<std::unique_ptr<juce::AudioProcessorEditor>> editors;
+    Timing mean;
+
+    const auto before = residentBytes();
+    for (int i = 0; i < iterations; ++i)
+    {
+        Timing t;
+        editors.push_back(openEditor(processor, t));
+        mean.constructMs += t.constructMs / (double) iterations;
+        mean.firstPaintMs += t.firstPaintMs / (double) iterations;
+    }
+    const auto after = residentBytes();
+
+    report("later", mean, countComponents(*editors.front()), before > 0 ? (after - before) / iterations : 0);
+    return 0;
+}
@@ -0,0 +1,401 @@
+// Software LFO check ("lfo" mode).
+//
+// 1. Runs LfoEngine side by side with a plain per-track reference (one scalar LFO per track, each
+//    waveform evaluated on its own) over 400 random LFO pages, with random trigs and page changes
+//    mid-run, and checks that both queue exactly the same CCs.
+// 2. Runs the processor with track 1's LFO modulating DECAY and checks that the device's own LFO
+//    page (CC 102-109) stays off the output apart from DEPTH 0, and that it is handed back once the
+//    software LFO stops.
+// Exits non-zero on the first difference.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "../source/PluginProcessor.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    namespace ids = ParameterIds;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numTracks = ids::numTracks;
+
+    struct Event
+    {
+        int position;
+        juce::uint8 bytes[3];
+    };
+
+    void setPlain (PluginProcessor& processor, int denseIndex, int plainValue)
+    {
+        if (auto* param = processor.parameterAt(denseIndex))
+            param->setValueNotifyingHost(param->convertTo0to1((float) plainValue));
+    }
+
+    // One track's LFO, written the straightforward way: every decision per track, every waveform
+    // through a switch.
+    struct ReferenceLfo
+    {
+        double phase = 0.0, fadeBeats = 0.0, held = 0.0, randomValue = 0.0;
+        juce::uint32 randomState = 0;
+        bool stopped = false, retrigger = false;
+        int activeDestination = -1, lastSent = -1, lastBase = -1, zeroedDepth = 0;
+
+        static double wrap (double p) { return p - std::floor(p); }
+
+        double nextRandom()
+        {
+            auto x = randomState;
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            randomState = x;
+            return (double) x / 2147483647.5 - 1.0;
+        }
+
+        double evaluate (int waveform, double p) const
+        {
+            const double envelopeFloor = std::exp(-4.0);
+
+            switch (juce::jlimit(0, 6, waveform))
+            {
+                case LfoEngine::triangle:      return p < 0.25 ? 4.0 * p : (p < 0.75 ? 2.0 - 4.0 * p : 4.0 * p - 4.0);
+                case LfoEngine::sine:          return std::sin(juce::MathConstants<double>::twoPi * p);
+                case LfoEngine::square:        return p < 0.5 ? 1.0 : -1.0;
+                case LfoEngine::saw:           return 2.0 * p - 1.0;
+                case LfoEngine::envelope:      return (std::exp(-4.0 * p) - envelopeFloor) / (1.0 - envelopeFloor);
+                case LfoEngine::ramp:          return p;
+                default:                       return randomValue;
+            }
+        }
+
+        static int baseValue (const TrackParameterSnapshot& params, int t, const ModelCyclesMidi::LfoDestination& d)
+        {
+            if (d.baseField < 0)
+                return d.baseOffset;
+
+            const int v = params.get((ids::TrackField) d.baseField, t);
+            return d.boolBase ? (v != 0 ? 127 : 0) : v + d.baseOffset;
+        }
+
+        void render (const TrackParameterSnapshot& params, int t, const juce::AudioPlayHead::PositionInfo& position,
+                     DinOutputScheduler& out)
+        {
+            const int mode = params.get(ids::lfoMode, t);
+            const int waveform = params.get(ids::lfoWaveform, t);
+            const double phaseOffset = (double) params.get(ids::lfoPhase, t) / 128.0;
+            const int fade = params.get(ids::lfoFade, t);
+            const int depth = params.get(ids::lfoDepth, t);
+
+            const double bpm = position.getBpm().orFallback(120.0);
+            const int m = juce::jlimit(0, 23, params.get(ids::lfoMultiply, t));
+            const bool synced = m < 12;
+            const double cyclesPerBeat = (double) params.get(ids::lfoSpeed, t) * (double) (1 << (m % 12)) / 512.0;
+            const double beats = (double) blockSize / (sampleRate * 60.0) * (synced ? bpm : 120.0);
+
+            if (retrigger)
+            {
+                retrigger = false;
+                fadeBeats = 0.0;
+
+                if (mode == LfoEngine::trigger || mode == LfoEngine::oneShot || mode == LfoEngine::halfShot)
+                {
+                    phase = 0.0;
+                    stopped = false;
+                    randomValue = nextRandom();
+                }
+                else if (mode == LfoEngine::hold)
+                {
+                    held = evaluate(waveform, wrap(phase + phaseOffset));
+                }
+            }
+
+            if (mode == LfoEngine::freeRunning && synced && position.getIsPlaying() && position.getPpqPosition().hasValue())
+                phase = wrap(*position.getPpqPosition() * cyclesPerBeat);
+
+            double gain = 1.0;
+            if (fade != 0)
+            {
+                const double progress = juce::jmin(1.0, fadeBeats * 16.0 / (double) std::abs(fade));
+                gain = fade < 0 ? progress : 1.0 - progress;
+            }
+
+            const double modulation = (mode == LfoEngine::hold ? held : evaluate(waveform, wrap(phase + phaseOffset))) * gain;
+
+            if (! stopped)
+            {
+                const double before = phase;
+                const double after = before + cyclesPerBeat * beats;
+                const double limit = mode == LfoEngine::oneShot ? 1.0 : (mode == LfoEngine::halfShot ? 0.5 : 0.0);
+
+                if (limit > 0.0 && std::abs(after) >= limit)
+                {
+                    phase = after < 0.0 ? -limit : limit;
+                    stopped = true;
+                }
+                else
+                {
+                    if (std::floor(after) != std::floor(before))
+                        randomValue = nextRandom();
+
+                    phase = limit > 0.0 ? after : wrap(after);
+                }
+            }
+
+            fadeBeats += beats;
+
+            const int numDestinations = (int) (sizeof(ModelCyclesMidi::lfoDestinations) / sizeof(ModelCyclesMidi::lfoDestinations[0]));
+            int destination = juce::jlimit(0, numDestinations - 1, params.get(ids::lfoDestination, t));
+            if (depth == 0 || ModelCyclesMidi::lfoDestinations[destination].cc < 0)
+                destination = -1;
+
+            const int channel = ModelCyclesMidi::trackChannel(t);
+
+            if (activeDestination != destination && activeDestination >= 0)
+            {
+                const auto& previous = ModelCyclesMidi::lfoDestinations[activeDestination];
+                out.queueControlChange(channel, previous.cc, baseValue(params, t, previous));
+                lastSent = -1;
+            }
+
+            activeDestination = destination;
+            if (destination < 0)
+            {
+                zeroedDepth = 0;
+                return;
+            }
+
+            if (depth != zeroedDepth)
+            {
+                zeroedDepth = depth;
+                out.queueControlChange(channel, 109, 64);
+            }
+
+            const auto& target = ModelCyclesMidi::lfoDestinations[destination];
+            const int base = baseValue(params, t, target);
+            const int value = juce::jlimit(0, 127, base + (int) std::lround((double) depth * modulation));
+
+            if (value != lastSent || base != lastBase)
+            {
+                lastSent = value;
+                lastBase = base;
+                out.queueControlChange(channel, target.cc, value);
+            }
+        }
+    };
+
+    void collect (DinOutputScheduler& scheduler, std::vector<Event>& events)
+    {
+        const juce::MidiBuffer none;
+        juce::MidiBuffer out;
+        events.clear();
+
+        if (! scheduler.process(none, none, out, blockSize))
+            return;
+
+        for (const auto metadata : out)
+            events.push_back({ metadata.samplePosition, { metadata.data[0], metadata.data[1], metadata.data[2] } });
+    }
+
+    void randomisePage (PluginProcessor& processor, juce::Random& random, int t)
+    {
+        setPlain(processor, ids::index(t, ids::lfoMode), random.nextInt(5));
+        setPlain(processor, ids::index(t, ids::lfoWaveform), random.nextInt(7));
+        setPlain(processor, ids::index(t, ids::lfoSpeed), random.nextInt(128) - 64);
+        setPlain(processor, ids::index(t, ids::lfoMultiply), random.nextInt(24));
+        setPlain(processor, ids::index(t, ids::lfoPhase), random.nextInt(128));
+        setPlain(processor, ids::index(t, ids::lfoFade), random.nextInt(128) - 64);
+        setPlain(processor, ids::index(t, ids::lfoDepth), random.nextInt(128) - 64);
+        setPlain(processor, ids::index(t, ids::lfoDestination), random.nextInt(14));
+        setPlain(processor, ids::index(t, ids::decay), random.nextInt(128));
+        setPlain(processor, ids::index(t, ids::mixPan), random.nextInt(128) - 64);
+    }
+
+    bool checkAgainstReference()
+    {
+        constexpr int numPages = 400;
+        constexpr int blocksPerPage = 300;
+
+        PluginProcessor processor;
+        TrackParameterSnapshot params;
+        params.attach(processor.apvts);
+
+        juce::Random random (1);
+        const PatternMorphEngine noMorph;
+        std::vector<Event> engineEvents, referenceEvents;
+        juce::int64 ccs = 0;
+
+        for (int page = 0; page < numPages; ++page)
+        {
+            LfoEngine engine;
+            std::array<ReferenceLfo, numTracks> reference;
+            DinOutputScheduler engineOut, referenceOut;
+            engineOut.prepare(sampleRate);
+            referenceOut.prepare(sampleRate);
+
+            engine.prepare(sampleRate);
+            for (int t = 0; t < numTracks; ++t)
+            {
+                reference[(size_t) t].randomState = 0x9e3779b9u * (juce::uint32) (t + 1);
+                randomisePage(processor, random, t);
+            }
+
+            juce::AudioPlayHead::PositionInfo position;
+            position.setBpm(90.0 + random.nextInt(100));
+            position.setIsPlaying(random.nextBool());
+            double ppq = 0.0;
+
+            for (int block = 0; block < blocksPerPage; ++block)
+            {
+                if (random.nextInt(4) == 0)
+                {
+                    const int t = random.nextInt(numTracks);
+                    engine.noteOn(t);
+                    reference[(size_t) t].retrigger = true;
+                }
+
+                if (random.nextInt(50) == 0)
+                    randomisePage(processor, random, random.nextInt(numTracks));
+
+                params.refresh();
+                position.setPpqPosition(ppq);
+                ppq += (double) blockSize / (sampleRate * 60.0) * *position.getBpm();
+
+                engine.render(params, noMorph, position, sampleRate, blockSize, engineOut);
+                for (int t = 0; t < numTracks; ++t)
+                    reference[(size_t) t].render(params, t, position, referenceOut);
+
+                collect(engineOut, engineEvents);
+                collect(referenceOut, referenceEvents);
+                ccs += (juce::int64) engineEvents.size();
+
+                bool same = engineEvents.size() == referenceEvents.size();
+                for (size_t i = 0; same && i < engineEvents.size(); ++i)
+                    same = engineEvents[i].position == referenceEvents[i].position
+                           && std::equal(engineEvents[i].bytes, engineEvents[i].bytes + 3, referenceEvents[i].bytes);
+
+                if (! same)
+                {
+                    std::printf("FAIL reference comparison: page %d, block %d (%zu CCs vs %zu)\n",
+                                page, block, engineEvents.size(), referenceEvents.size());
+                    return false;
+                }
+            }
+        }
+
+        std::printf("ok   reference comparison: %d pages x %d blocks, %lld CCs identical\n",
+                    numPages, blocksPerPage, (long long) ccs);
+        return true;
+    }
+
+    struct RunningPlayHead final : public juce::AudioPlayHead
+    {
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+            info.setIsPlaying(true);
+            info.setBpm(120.0);
+            info.setTimeInSamples(timeInSamples);
+            info.setPpqPosition((double) timeInSamples / (sampleRate / 2.0));
+            return info;
+        }
+
+        juce::int64 timeInSamples = 0;
+    };
+
+    // Processes `numBlocks` empty blocks and returns the CCs sent on `channel`.
+    std::vector<Event> run (PluginProcessor& processor, RunningPlayHead& playHead, int numBlocks, int channel)
+    {
+        juce::AudioBuffer<float> audio (2, blockSize);
+        juce::MidiBuffer midi;
+        std::vector<Event> sent;
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            audio.clear();
+            midi.clear();
+            processor.processBlock(audio, midi);
+            playHead.timeInSamples += blockSize;
+
+            for (const auto metadata : midi)
+                if (metadata.numBytes == 3 && metadata.data[0] == 0xb0 + channel - 1)
+                    sent.push_back({ metadata.samplePosition, { metadata.data[0], metadata.data[1], metadata.data[2] } });
+        }
+
+        return sent;
+    }
+
+    bool checkHardwareLfoHeldBack()
+    {
+        PluginProcessor processor;
+        RunningPlayHead playHead;
+        processor.setPlayHead(&playHead);
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        // Track 1: one cycle per beat on DECAY.
+        setPlain(processor, ids::index(0, ids::lfoSpeed), 32);
+        setPlain(processor, ids::index(0, ids::lfoMultiply), 4);
+        setPlain(processor, ids::index(0, ids::lfoDestination), 3);
+        setPlain(processor, ids::index(0, ids::decay), 64);
+        setPlain(processor, ids::index(0, ids::lfoDepth), 40);
+
+        int decayCcs = 0;
+        for (const auto& e : run(processor, playHead, 200, 1))
+        {
+            if (e.bytes[1] == 80)
+                ++decayCcs;
+
+            if ((e.bytes[1] >= 102 && e.bytes[1] < 109) || (e.bytes[1] == 109 && e.bytes[2] != 64))
+            {
+                std::printf("FAIL hardware LFO: CC %d = %d sent while the software LFO runs\n", e.bytes[1], e.bytes[2]);
+                return false;
+            }
+        }
+
+        if (decayCcs < 2)
+        {
+            std::printf("FAIL hardware LFO: DECAY was not modulated (%d CCs)\n", decayCcs);
+            return false;
+        }
+
+        // DEPTH 0 stops the software LFO; the device's LFO gets the page back.
+        setPlain(processor, ids::index(0, ids::lfoDepth), 0);
+
+        bool speedSent = false, destinationSent = false;
+        for (const auto& e : run(processor, playHead, 20, 1))
+        {
+            speedSent = speedSent || (e.bytes[1] == 102 && e.bytes[2] == 32 + 64);
+            destinationSent = destinationSent || (e.bytes[1] == 105 && e.bytes[2] == 3);
+        }
+
+        processor.releaseResources();
+        processor.setPlayHead(nullptr);
+
+        if (! speedSent || ! destinationSent)
+        {
+            std::printf("FAIL hardware LFO: the LFO page was not handed back to the device\n");
+            return false;
+        }
+
+        std::printf("ok   hardware LFO held back: %d DECAY CCs, no LFO page CCs, page re-sent on release\n", decayCcs);
+        return true;
+    }
+}
+
+int runLfoCheck()
+{
+    std::printf("lfo: software LFO engine at %.0f Hz, %d-sample blocks\n\n", sampleRate, blockSize);
+
+    bool ok = checkAgainstReference();
+    ok = checkHardwareLfoHeldBack() && ok;
+
+    return ok ? 0 : 1;
+}
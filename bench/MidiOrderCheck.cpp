@@ -0,0 +1,214 @@
+// Output order check for the DIN scheduler ("midiorder" mode).
+//
+// Feeds DinOutputScheduler host MIDI mixing notes, program changes, paced CCs, bank select and
+// channel mode CCs, block by block, and checks what comes out: non-CC events (and the unpaced CCs)
+// keep their exact sample and their order, no paced CC goes out before its own sample or ahead of
+// an event that came before it, and with a quiet link the output order is exactly the input order.
+// Exits non-zero on the first violation.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "../source/midi_components/DinOutputScheduler.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 256;
+
+    struct Event
+    {
+        juce::int64 time;
+        juce::uint8 bytes[3];
+    };
+
+    bool isPacedCc (const juce::uint8* bytes)
+    {
+        return (bytes[0] & 0xf0) == 0xb0 && bytes[1] != 0 && bytes[1] != 32 && bytes[1] < 120;
+    }
+
+    // Every input event is told apart by its first two bytes (the scenarios use distinct notes,
+    // programs and controllers).
+    int findInput (const std::vector<Event>& input, const juce::uint8* bytes)
+    {
+        for (size_t i = 0; i < input.size(); ++i)
+            if (input[i].bytes[0] == bytes[0] && input[i].bytes[1] == bytes[1])
+                return (int) i;
+
+        return -1;
+    }
+
+    // Runs `input` (sorted by time) through a fresh scheduler, plus enough empty blocks to drain it.
+    std::vector<Event> schedule (const std::vector<Event>& input)
+    {
+        DinOutputScheduler scheduler;
+        scheduler.prepare(sampleRate);
+
+        juce::MidiBuffer in, none, out;
+        std::vector<Event> output;
+
+        const auto lastTime = input.empty() ? 0 : input.back().time;
+        for (juce::int64 start = 0; start <= lastTime + (juce::int64) sampleRate; start += blockSize)
+        {
+            in.clear();
+            for (const auto& e : input)
+                if (e.time >= start && e.time < start + blockSize)
+                    in.addEvent(e.bytes, 3, (int) (e.time - start));
+
+            const auto& sent = scheduler.process(in, none, out, blockSize) ? out : in;
+            for (const auto metadata : sent)
+            {
+                Event e { start + metadata.samplePosition, { 0, 0, 0 } };
+                std::copy(metadata.data, metadata.data + juce::jmin(3, metadata.numBytes), e.bytes);
+                output.push_back(e);
+            }
+        }
+
+        return output;
+    }
+
+    bool check (const char* name, const std::vector<Event>& input, bool expectInputOrder)
+    {
+        const auto output = schedule(input);
+
+        auto fail = [name] (const char* what, const Event& e)
+        {
+            std::printf("FAIL %-26s %s (%02x %02x %02x at %lld)\n", name, what,
+                        e.bytes[0], e.bytes[1], e.bytes[2], (long long) e.time);
+            return false;
+        };
+
+        size_t unpacedSent = 0;
+        int lastInputIndex = -1;
+
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            const auto& e = output[i];
+            const int index = findInput(input, e.bytes);
+            if (index < 0)
+                return fail("unexpected event", e);
+
+            const auto& source = input[(size_t) index];
+
+            if (expectInputOrder && index <= lastInputIndex)
+                return fail("out of input order", e);
+            lastInputIndex = index;
+
+            if (isPacedCc(e.bytes))
+            {
+                if (e.time < source.time)
+                    return fail("CC sent before its own sample", e);
+
+                // Every unpaced event queued ahead of this CC must already be out.
+                for (int j = 0; j < index; ++j)
+                {
+                    if (isPacedCc(input[(size_t) j].bytes))
+                        continue;
+
+                    bool seen = false;
+                    for (size_t k = 0; k < i && ! seen; ++k)
+                        seen = output[k].bytes[0] == input[(size_t) j].bytes[0] && output[k].bytes[1] == input[(size_t) j].bytes[1];
+
+                    if (! seen)
+                        return fail("CC overtook an earlier event", e);
+                }
+
+                continue;
+            }
+
+            // Unpaced events go out exactly once, in input order, at their own sample.
+            while (unpacedSent < input.size() && isPacedCc(input[unpacedSent].bytes))
+                ++unpacedSent;
+
+            if (unpacedSent >= input.size() || (size_t) index != unpacedSent)
+                return fail("unpaced event reordered", e);
+
+            if (e.time != source.time)
+                return fail("unpaced event moved", e);
+
+            ++unpacedSent;
+        }
+
+        for (size_t j = unpacedSent; j < input.size(); ++j)
+            if (! isPacedCc(input[j].bytes))
+                return fail("unpaced event lost", input[j]);
+
+        std::printf("ok   %-26s %zu events in, %zu out\n", name, input.size(), output.size());
+        return true;
+    }
+
+    Event note (juce::int64 time, int channel, int number, bool on)
+    {
+        return { time, { (juce::uint8) ((on ? 0x90 : 0x80) | (channel - 1)), (juce::uint8) number, (juce::uint8) (on ? 100 : 0) } };
+    }
+
+    Event cc (juce::int64 time, int channel, int controller, int value)
+    {
+        return { time, { (juce::uint8) (0xb0 | (channel - 1)), (juce::uint8) controller, (juce::uint8) value } };
+    }
+
+    Event program (juce::int64 time, int channel, int number)
+    {
+        return { time, { (juce::uint8) (0xc0 | (channel - 1)), (juce::uint8) number, 0 } };
+    }
+
+    // A quiet link: every paced CC has room before the next event, or shares its sample.
+    std::vector<Event> sparse()
+    {
+        return {
+            note(0, 1, 60, true),
+            cc(100, 1, 74, 10),
+            program(200, 1, 3),
+            cc(300, 1, 71, 20),          // same sample as, and ahead of, the next note
+            note(300, 1, 62, true),
+            note(400, 1, 60, false),
+            cc(400, 1, 10, 30),          // same sample as, and after, the previous note
+            cc(520, 1, 0, 1),            // bank select, unpaced
+            cc(521, 1, 32, 0),
+            program(522, 1, 4),
+            cc(700, 1, 12, 40),          // last event of its block, sent from the block's tail
+            note(800, 1, 62, false),
+            cc(900, 1, 123, 0),          // all notes off, unpaced
+        };
+    }
+
+    // More CCs than the link can carry between dense notes: CCs are delayed, never early.
+    std::vector<Event> saturated()
+    {
+        std::vector<Event> events;
+        int controller = 1;
+
+        for (int step = 0; step < 24; ++step)
+        {
+            const juce::int64 t = step * 40;
+
+            for (int i = 0; i < 3 && controller < 120; ++i, ++controller)
+                if (controller != 32)
+                    events.push_back(cc(t, 1 + (step % 6), controller, step));
+
+            events.push_back(note(t + 5, 1 + (step % 6), 36 + step, true));
+
+            if (step % 8 == 7)
+            {
+                events.push_back(cc(t + 10, 1 + (step % 6), 0, step));
+                events.push_back(program(t + 10, 1 + (step % 6), step));
+            }
+        }
+
+        return events;
+    }
+}
+
+int runMidiOrderCheck()
+{
+    std::printf("midiorder: DIN scheduler output order at %.0f Hz, %d-sample blocks\n\n", sampleRate, blockSize);
+
+    bool ok = check("sparse (exact input order)", sparse(), true);
+    ok = check("saturated link", saturated(), false) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+// Headless micro-benchmark for the MIDI path ("processblock" mode).
+//
+// Creates a PluginProcessor without an editor and feeds processBlock synthetic MIDI streams at a
+// range of buffer sizes, reporting the mean cost per block and per input event. Only the
+// processBlock call itself is timed; building each block's input buffer is not.
+//
+// It also counts heap allocations (operator new / delete, through JUCE's allocation hooks) made
+// inside processBlock after the first block of each run, and exits non-zero if any stream made one.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "../source/PluginProcessor.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int samplesPerSixteenth = 6000; // 120 BPM at 48 kHz
+    constexpr int numTracks = 6;
+    constexpr int secondsPerRun = 20;
+
+    // Appends every event of a stream that falls inside [blockStart, blockStart + numSamples).
+    using StreamFn = std::function<void (juce::MidiBuffer&, juce::int64 blockStart, int numSamples)>;
+
+    // Parameter moves made before a block (not timed, allocations not counted).
+    using ControlFn = std::function<void (PluginProcessor&, juce::int64 blockStart, int numSamples)>;
+
+    struct Stream
+    {
+        const char* name;
+        StreamFn fill;
+        ControlFn control = nullptr; // with a control function the transport runs (see BenchPlayHead)
+    };
+
+    // A running transport at 120 BPM in 4/4, following the bench's sample counter.
+    struct BenchPlayHead final : public juce::AudioPlayHead
+    {
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            const double ppq = (double) timeInSamples / (double) (samplesPerSixteenth * 4);
+
+            PositionInfo info;
+            info.setIsPlaying(true);
+            info.setBpm(120.0);
+            info.setTimeSignature(TimeSignature {});
+            info.setTimeInSamples(timeInSamples);
+            info.setPpqPosition(ppq);
+            info.setPpqPositionOfLastBarStart(std::floor(ppq / 4.0) * 4.0);
+            return info;
+        }
+
+        juce::int64 timeInSamples = 0;
+    };
+
+    // Counts operator new / delete calls made on this thread while `counting` is set.
+    struct AllocationCounter final : public juce::AllocationHooks::Listener
+    {
+        void newOrDeleteCalled() noexcept override
+        {
+            if (counting)
+                ++count;
+        }
+
+        bool counting = false;
+        juce::int64 count = 0;
+    };
+
+    void setPlain (PluginProcessor& processor, int denseIndex, int plainValue)
+    {
+        if (auto* param = processor.parameterAt(denseIndex))
+            param->setValueNotifyingHost(param->convertTo0to1((float) plainValue));
+    }
+
+    void addNote (juce::MidiBuffer& midi, juce::int64 blockStart, int numSamples,
+                  juce::int64 onAt, int length, int channel, int note)
+    {
+        const auto end = blockStart + numSamples;
+
+        if (onAt >= blockStart && onAt < end)
+            midi.addEvent(juce::MidiMessage::noteOn(channel, note, (juce::uint8) 100), (int) (onAt - blockStart));
+
+        const auto offAt = onAt + length;
+        if (offAt >= blockStart && offAt < end)
+            midi.addEvent(juce::MidiMessage::noteOff(channel, note), (int) (offAt - blockStart));
+    }
+
+    // Calls fn(k, t) for each k with t = k * period + offset inside the block (including notes
+    // started in an earlier block whose off falls in this one).
+    template <typename Fn>
+    void forEachTick (juce::int64 blockStart, int numSamples, int period, int lookBehind, Fn&& fn)
+    {
+        auto first = (blockStart - lookBehind) / period;
+        if (first < 0)
+            first = 0;
+
+        for (auto k = first; k * period < blockStart + numSamples; ++k)
+            fn(k, k * period);
+    }
+
+    std::vector<Stream> makeStreams()
+    {
+        return {
+            { "sparse notes", [] (juce::MidiBuffer& midi, juce::int64 start, int n)
+              {
+                  // One quarter note on track 1, every beat.
+                  const int period = samplesPerSixteenth * 4;
+                  forEachTick(start, n, period, period / 2, [&] (juce::int64, juce::int64 t)
+                  {
+                      addNote(midi, start, n, t, period / 2, 1, 60);
+                  });
+              } },
+
+            { "16th hats x6", [] (juce::MidiBuffer& midi, juce::int64 start, int n)
+              {
+                  // A short note on every track, every 16th.
+                  const int period = samplesPerSixteenth;
+                  forEachTick(start, n, period, period / 2, [&] (juce::int64, juce::int64 t)
+                  {
+                      for (int ch = 1; ch <= numTracks; ++ch)
+                          addNote(midi, start, n, t, period / 2, ch, 42);
+                  });
+              } },
+
+            { "CC flood", [] (juce::MidiBuffer& midi, juce::int64 start, int n)
+              {
+                  // A controller sweep every 32 samples, rotating across the track channels.
+                  forEachTick(start, n, 32, 0, [&] (juce::int64 k, juce::int64 t)
+                  {
+                      if (t >= start)
+                          midi.addEvent(juce::MidiMessage::controllerEvent((int) (k % numTracks) + 1, 74, (int) (k & 127)),
+                                        (int) (t - start));
+                  });
+              } },
+
+            { "dense playing", [] (juce::MidiBuffer& midi, juce::int64 start, int n)
+              {
+                  // 16ths on every track plus a CC every 64 samples, with the transport running.
+                  forEachTick(start, n, samplesPerSixteenth, samplesPerSixteenth / 2, [&] (juce::int64, juce::int64 t)
+                  {
+                      for (int ch = 1; ch <= numTracks; ++ch)
+                          addNote(midi, start, n, t, samplesPerSixteenth / 2, ch, 40 + ch);
+                  });
+
+                  forEachTick(start, n, 64, 0, [&] (juce::int64 k, juce::int64 t)
+                  {
+                      if (t >= start)
+                          midi.addEvent(juce::MidiMessage::controllerEvent((int) (k % numTracks) + 1, 16, (int) (k & 127)),
+                                        (int) (t - start));
+                  });
+              },
+              [] (PluginProcessor& processor, juce::int64 start, int n)
+              {
+                  namespace ids = ParameterIds;
+
+                  // Swing on every track, so swung notes come back from the swing queue.
+                  if (start == 0)
+                      for (int t = 0; t < numTracks; ++t)
+                          setPlain(processor, ids::index(t, ids::swing), 64);
+
+                  // Every beat one track is muted (panic) and the previous one unmuted; every bar the
+                  // pattern changes (a Program Change at the bar line).
+                  const int beat = samplesPerSixteenth * 4;
+                  const auto firstBeat = (start + beat - 1) / beat;
+                  for (auto k = firstBeat; k * beat < start + n; ++k)
+                  {
+                      setPlain(processor, ids::index((int) (k % numTracks), ids::unmuted), 0);
+                      setPlain(processor, ids::index((int) ((k + numTracks - 1) % numTracks), ids::unmuted), 1);
+
+                      if (k % 4 == 0)
+                          setPlain(processor, ids::index(ids::patternIndexGlobal), (int) ((k / 4) % 16));
+                  }
+              } },
+        };
+    }
+
+    struct Result
+    {
+        double nsPerBlock = 0.0;
+        double nsPerEvent = 0.0;
+        double worstBlockNs = 0.0;
+        juce::int64 events = 0;
+        juce::uint64 ccsSent = 0;
+        juce::uint64 ccsCoalesced = 0;
+        juce::uint64 ccsDropped = 0;
+        juce::int64 allocations = 0;
+    };
+
+    Result runStream (PluginProcessor& processor, const Stream& stream, int blockSize)
+    {
+        BenchPlayHead playHead;
+        processor.setPlayHead(stream.control != nullptr ? &playHead : nullptr);
+
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        AllocationCounter allocations;
+        juce::getAllocationHooksForThread().addListener(&allocations);
+
+        juce::AudioBuffer<float> audio (2, blockSize);
+        audio.clear();
+
+        juce::MidiBuffer midi;
+        midi.ensureSize(4096);
+
+        const auto totalSamples = (juce::int64) sampleRate * secondsPerRun;
+        const auto numBlocks = totalSamples / blockSize;
+
+        Result result;
+        juce::int64 totalTicks = 0;
+
+        const auto& stats = processor.getMidiOutputStats();
+        const auto sentBefore = stats.ccsSent.load();
+        const auto coalescedBefore = stats.ccsCoalesced.load();
+        const auto droppedBefore = stats.ccsDropped.load();
+        juce::int64 worstTicks = 0;
+
+        // One untimed pass over the first second warms the caches. Allocations are counted from the
+        // second block on: only the very first block may touch anything for the first time.
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            const bool timed = pass == 1;
+            const auto blocks = timed ? numBlocks : (juce::int64) sampleRate / blockSize;
+
+            for (juce::int64 b = 0; b < blocks; ++b)
+            {
+                // The timed pass starts over from sample 0 (the transport restarts with it).
+                const auto blockStart = b * blockSize;
+                playHead.timeInSamples = blockStart;
+
+                if (stream.control != nullptr)
+                    stream.control(processor, blockStart, blockSize);
+
+                midi.clear();
+                stream.fill(midi, blockStart, blockSize);
+
+                const auto eventsIn = midi.getNumEvents();
+                allocations.counting = timed || b > 0;
+                const auto before = juce::Time::getHighResolutionTicks();
+                processor.processBlock(audio, midi);
+                const auto ticks = juce::Time::getHighResolutionTicks() - before;
+                allocations.counting = false;
+
+                if (timed)
+                {
+                    totalTicks += ticks;
+                    worstTicks = juce::jmax(worstTicks, ticks);
+                    result.events += eventsIn;
+                }
+            }
+        }
+
+        juce::getAllocationHooksForThread().removeListener(&allocations);
+        processor.releaseResources();
+        processor.setPlayHead(nullptr);
+        result.allocations = allocations.count;
+
+        // Includes the warm-up pass; these describe the DIN pacing, not the timing.
+        result.ccsSent = stats.ccsSent.load() - sentBefore;
+        result.ccsCoalesced = stats.ccsCoalesced.load() - coalescedBefore;
+        result.ccsDropped = stats.ccsDropped.load() - droppedBefore;
+
+        const double totalNs = juce::Time::highResolutionTicksToSeconds(totalTicks) * 1.0e9;
+        result.nsPerBlock = totalNs / (double) numBlocks;
+        result.nsPerEvent = result.events > 0 ? totalNs / (double) result.events : 0.0;
+        result.worstBlockNs = juce::Time::highResolutionTicksToSeconds(worstTicks) * 1.0e9;
+        return result;
+    }
+}
+
+int runProcessBlockBench()
+{
+    PluginProcessor processor;
+
+    std::printf("processBlock: %d s of audio per run at %.0f Hz, 120 BPM\n\n",
+                secondsPerRun, sampleRate);
+    std::printf("%-14s %6s %10s %12s %12s %12s %10s %10s %8s %7s\n",
+                "stream", "block", "events", "ns/block", "worst ns", "ns/event",
+                "ccs out", "coalesced", "dropped", "allocs");
+
+    juce::int64 totalAllocations = 0;
+
+    for (const auto& stream : makeStreams())
+    {
+        for (int blockSize = 16; blockSize <= 2048; blockSize *= 2)
+        {
+            const auto r = runStream(processor, stream, blockSize);
+            std::printf("%-14s %6d %10lld %12.1f %12.1f %12.1f %10llu %10llu %8llu %7lld\n",
+                        stream.name, blockSize, (long long) r.events,
+                        r.nsPerBlock, r.worstBlockNs, r.nsPerEvent,
+                        (unsigned long long) r.ccsSent, (unsigned long long) r.ccsCoalesced,
+                        (unsigned long long) r.ccsDropped, (long long) r.allocations);
+
+            totalAllocations += r.allocations;
+        }
+
+        std::printf("\n");
+    }
+
+    if (totalAllocations > 0)
+    {
+        std::printf("FAIL: processBlock allocated %lld times after the first block\n", (long long) totalAllocations);
+        return 1;
+    }
+
+    return 0;
+}
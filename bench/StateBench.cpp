@@ -0,0 +1,194 @@
+// Save/restore cost of the plug-in state ("state" mode): the binary StateCodec path used by
+// get/setStateInformation against the previous XML path (copyState -> createXml -> copyXmlToBinary,
+// loaded back through the XML fallback). Starts with a round-trip check of the binary state
+// (parameters and pattern snapshots) and exits non-zero if it fails.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#include "../source/PluginProcessor.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    constexpr int iterations = 2000;
+
+    // Non-default values everywhere, so neither path gets to skip anything.
+    void randomiseParameters (PluginProcessor& processor, juce::int64 seed)
+    {
+        juce::Random random (seed);
+
+        for (int i = 0; i < ParameterIds::numParameters; ++i)
+            if (auto* param = processor.parameterAt(i))
+                param->setValueNotifyingHost(random.nextFloat());
+    }
+
+    bool sameSnapshots (const PatternSnapshotStore& a, const PatternSnapshotStore& b)
+    {
+        for (int slot = 0; slot < PatternSnapshotStore::numSlots; ++slot)
+        {
+            if (a.has(slot) != b.has(slot))
+                return false;
+
+            if (a.has(slot) && std::memcmp(a.slotData(slot), b.slotData(slot), PatternSnapshotStore::valuesPerSlot) != 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    // Saves a state with non-default parameters and some pattern snapshots, restores it into the
+    // processor that made it and a fresh one, and checks that both save it back unchanged.
+    bool checkRoundTrip()
+    {
+        PluginProcessor processor;
+        randomiseParameters(processor, 3);
+
+        juce::MemoryBlock saved;
+        processor.getStateInformation(saved);
+
+        StateCodec::Values values {};
+        auto snapshots = std::make_unique<PatternSnapshotStore>();
+        if (! StateCodec::decode(saved.getData(), (int) saved.getSize(), values, *snapshots))
+        {
+            std::printf("FAIL round trip: the processor's own state does not decode\n");
+            return false;
+        }
+
+        juce::Random random (4);
+        for (int slot = 0; slot < PatternSnapshotStore::numSlots; slot += 7)
+        {
+            auto* data = snapshots->slotData(slot);
+            for (int i = 0; i < PatternSnapshotStore::valuesPerSlot; ++i)
+                data[i] = (juce::int8) (random.nextInt(256) - 128);
+
+            snapshots->markStored(slot);
+        }
+
+        juce::MemoryBlock blob;
+        StateCodec::encode(values, *snapshots, blob);
+
+        StateCodec::Values decodedValues {};
+        auto decodedSnapshots = std::make_unique<PatternSnapshotStore>();
+        if (! StateCodec::decode(blob.getData(), (int) blob.getSize(), decodedValues, *decodedSnapshots)
+            || decodedValues != values || ! sameSnapshots(*snapshots, *decodedSnapshots))
+        {
+            std::printf("FAIL round trip: StateCodec does not decode what it encoded\n");
+            return false;
+        }
+
+        // The same blob marked version 2 stores CHANCE as a drop probability: only CHANCE changes.
+        {
+            auto v2 = blob;
+            static_cast<juce::uint8*>(v2.getData())[sizeof(StateCodec::magic)] = 2;
+
+            StateCodec::Values migrated {};
+            auto migratedSnapshots = std::make_unique<PatternSnapshotStore>();
+            bool ok = StateCodec::decode(v2.getData(), (int) v2.getSize(), migrated, *migratedSnapshots);
+
+            for (int i = 0; ok && i < ParameterIds::numParameters; ++i)
+            {
+                const bool isChance = ParameterIds::isTrackIndex(i) && ParameterIds::fieldOfIndex(i) == ParameterIds::chance;
+                ok = migrated[(size_t) i] == (isChance ? 127 - values[(size_t) i] : values[(size_t) i]);
+            }
+
+            if (! ok)
+            {
+                std::printf("FAIL round trip: a version 2 state's CHANCE is not converted\n");
+                return false;
+            }
+        }
+
+        PluginProcessor fresh;
+        for (auto* target : { &processor, &fresh })
+        {
+            target->setStateInformation(blob.getData(), (int) blob.getSize());
+
+            juce::MemoryBlock again;
+            target->getStateInformation(again);
+
+            if (again != blob)
+            {
+                std::printf("FAIL round trip: %s processor does not save the state it restored\n",
+                            target == &fresh ? "a fresh" : "the");
+                return false;
+            }
+        }
+
+        std::printf("round trip ok (%d parameters, %d pattern snapshots, %zu bytes)\n\n",
+                    ParameterIds::numParameters, (PatternSnapshotStore::numSlots + 6) / 7, blob.getSize());
+        return true;
+    }
+
+    template <typename Fn>
+    double microsecondsPerCall (Fn&& fn)
+    {
+        fn(); // warm-up
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+            fn();
+
+        const auto ticks = juce::Time::getHighResolutionTicks() - start;
+        return juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e6 / (double) iterations;
+    }
+
+    void report (const char* name, size_t bytes, double saveUs, double loadSameUs, double loadOtherUs)
+    {
+        std::printf("%-8s %10zu %12.2f %14.2f %14.2f\n", name, bytes, saveUs, loadSameUs, loadOtherUs);
+    }
+
+    // Load cost when nothing changes (host re-sending the current state) and when alternating
+    // between two states that differ in every parameter (preset recall).
+    template <typename SaveFn>
+    void measure (const char* name, PluginProcessor& processor, SaveFn&& save)
+    {
+        juce::MemoryBlock a, b;
+        randomiseParameters(processor, 1);
+        save(a);
+        randomiseParameters(processor, 2);
+        save(b);
+
+        const auto saveUs = microsecondsPerCall([&] { save(b); });
+        const auto loadSameUs = microsecondsPerCall([&] { processor.setStateInformation(b.getData(), (int) b.getSize()); });
+
+        int flip = 0;
+        const auto loadOtherUs = microsecondsPerCall([&]
+        {
+            const auto& blob = (++flip & 1) != 0 ? a : b;
+            processor.setStateInformation(blob.getData(), (int) blob.getSize());
+        });
+
+        report(name, b.getSize(), saveUs, loadSameUs, loadOtherUs);
+    }
+}
+
+int runStateBench()
+{
+    if (! checkRoundTrip())
+        return 1;
+
+    PluginProcessor processor;
+
+    std::printf("state: %d parameters, mean of %d calls\n\n", ParameterIds::numParameters, iterations);
+    std::printf("%-8s %10s %12s %14s %14s\n", "format", "bytes", "save us", "load same us", "load other us");
+
+    measure("binary", processor, [&] (juce::MemoryBlock& blob)
+    {
+        blob.reset();
+        processor.getStateInformation(blob);
+    });
+
+    // The pre-binary path; such blobs still load through the XML fallback in setStateInformation.
+    measure("xml", processor, [&] (juce::MemoryBlock& blob)
+    {
+        blob.reset();
+        if (auto xml = processor.apvts.copyState().createXml())
+            juce::AudioProcessor::copyXmlToBinary(*xml, blob);
+    });
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+// Cost of switching the editor's active track ("trackswitch" mode): rebuilding one APVTS attachment
+// per track control by string ID (the previous rebuildTrackAttachments path) against re-pointing
+// the dense-index TrackParameterAttachments created once (setTrack). Uses plain controls for every
+// per-track field the track page binds, so widget painting is left out of both numbers.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "../source/PluginProcessor.h"
+#include "../source/ui_components/TrackParameterAttachment.h"
+#include "Benchmarks.h"
+
+namespace
+{
+    constexpr int iterations = 2000;
+
+    template <typename Fn>
+    double microsecondsPerCall (Fn&& fn)
+    {
+        fn(); // warm-up
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+            fn();
+
+        const auto ticks = juce::Time::getHighResolutionTicks() - start;
+        return juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e6 / (double) iterations;
+    }
+
+    // One control per field, of the kind the editor uses for that parameter type.
+    struct TrackControls
+    {
+        explicit TrackControls (PluginProcessor& processor)
+        {
+            for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+            {
+                const auto field = (ParameterIds::TrackField) f;
+                if (field == ParameterIds::unmuted || field == ParameterIds::machine)
+                    continue;
+
+                auto* param = processor.parameterAt(ParameterIds::index(0, field));
+
+                if (dynamic_cast<juce::AudioParameterBool*>(param) != nullptr)
+                {
+                    buttons.push_back({ field, std::make_unique<juce::ToggleButton>() });
+                }
+                else if (auto* choice = dynamic_cast<juce::AudioParameterChoice*>(param))
+                {
+                    auto combo = std::make_unique<juce::ComboBox>();
+                    combo->addItemList(choice->choices, 1);
+                    combos.push_back({ field, std::move(combo) });
+                }
+                else
+                {
+                    sliders.push_back({ field, std::make_unique<juce::Slider>() });
+                }
+            }
+        }
+
+        int size() const { return (int) (sliders.size() + buttons.size() + combos.size()); }
+
+        template <typename Control>
+        using Bound = std::vector<std::pair<ParameterIds::TrackField, std::unique_ptr<Control>>>;
+
+        Bound<juce::Slider> sliders;
+        Bound<juce::ToggleButton> buttons;
+        Bound<juce::ComboBox> combos;
+    };
+
+    using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
+    using ButtonAttachment = juce::AudioProcessorValueTreeState::ButtonAttachment;
+    using ComboBoxAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
+
+    double measureRebuild (PluginProcessor& processor, TrackControls& controls)
+    {
+        std::vector<std::unique_ptr<SliderAttachment>> sliders;
+        std::vector<std::unique_ptr<ButtonAttachment>> buttons;
+        std::vector<std::unique_ptr<ComboBoxAttachment>> combos;
+        int track = 0;
+
+        return microsecondsPerCall([&]
+        {
+            track = (track + 1) % ParameterIds::numTracks;
+
+            sliders.clear();
+            buttons.clear();
+            combos.clear();
+
+            for (auto& [field, s] : controls.sliders)
+                sliders.push_back(std::make_unique<SliderAttachment>(processor.apvts, ParameterIds::trackId(track, field), *s));
+            for (auto& [field, b] : controls.buttons)
+                buttons.push_back(std::make_unique<ButtonAttachment>(processor.apvts, ParameterIds::trackId(track, field), *b));
+            for (auto& [field, c] : controls.combos)
+                combos.push_back(std::make_unique<ComboBoxAttachment>(processor.apvts, ParameterIds::trackId(track, field), *c));
+        });
+    }
+
+    double measureRetarget (PluginProcessor& processor, TrackControls& controls)
+    {
+        std::vector<std::unique_ptr<TrackParameterAttachment>> attachments;
+
+        for (auto& [field, s] : controls.sliders)
+            attachments.push_back(std::make_unique<TrackSliderAttachment>(processor, field, *s));
+        for (auto& [field, b] : controls.buttons)
+            attachments.push_back(std::make_unique<TrackButtonAttachment>(processor, field, *b));
+        for (auto& [field, c] : controls.combos)
+            attachments.push_back(std::make_unique<TrackComboBoxAttachment>(processor, field, *c));
+
+        int track = 0;
+
+        return microsecondsPerCall([&]
+        {
+            track = (track + 1) % ParameterIds::numTracks;
+
+            for (auto& a : attachments)
+                a->setTrack(track);
+        });
+    }
+}
+
+int runTrackSwitchBench()
+{
+    PluginProcessor processor;
+
+    // Different values on every track, so each switch moves every control.
+    juce::Random random (1);
+    for (int i = 0; i < ParameterIds::numParameters; ++i)
+        if (auto* param = processor.parameterAt(i))
+            param->setValueNotifyingHost(random.nextFloat());
+
+    TrackControls controls (processor);
+
+    std::printf("trackswitch: %d controls, mean of %d switches\n\n", controls.size(), iterations);
+    std::printf("%-10s %12s\n", "path", "us/switch");
+
+    const auto rebuildUs = measureRebuild(processor, controls);
+    std::printf("%-10s %12.2f\n", "rebuild", rebuildUs);
+
+    const auto retargetUs = measureRetarget(processor, controls);
+    std::printf("%-10s %12.2f\n", "retarget", retargetUs);
+
+    return 0;
+}
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "ParameterIds.h"
+#include "StateCodec.h"
+
+// A library of kits (full 6-track sound settings) stored in one file with a fixed-size index:
+//
+//   header  32 bytes  "MCYK", version, kit count, tracks, fields per track, index offset, data offset,
+//                     field table offset
+//   fields  24 bytes per field: the track field's ParameterIds name (NUL padded), in stored order
+//   index   48 bytes per kit: UTF-8 name (40 bytes, NUL padded), offset into the data block
+//   data    tracks * fields int8 values per kit (every per-track parameter fits in -128..127)
+//
+// load() memory-maps the file and copies the index and the data block out as two raw blocks, so
+// hundreds of kits cost one read and no per-kit parsing: a kit's name and values are only decoded
+// when getName() or applyTo() asks for that kit. Nothing touches the file after load() except
+// rename() and add(), which reload it first (other plug-in instances share it), make their change
+// and write it back. The mapping itself is not kept open, so other instances can rewrite the file.
+// Stored fields are matched to the current layout by name, so fields can be added, removed or
+// reordered without misreading older kits; versions 1 and 2 had no field table and are read in
+// the layout they were written with (the current field order, truncated to their field count).
+// Mutes are performance state, not part of the sound: they are never stored, and a kit leaves
+// them as they are. Version 1 files hold CHANCE as a drop probability; read() turns it into the
+// play probability.
+class KitLibrary final
+{
+public:
+    static constexpr int nameBytes = 40;
+    static constexpr int formatVersion = 3;
+
+    KitLibrary() = default;
+
+    // Default location: <user app data>/toolBoy/ModelCycles/Kits.mckits
+    static juce::File defaultFile()
+    {
+        return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+            .getChildFile("toolBoy")
+            .getChildFile("ModelCycles")
+            .getChildFile("Kits.mckits");
+    }
+
+    int size() const noexcept { return (int) count; }
+
+    juce::String getName(int kit) const
+    {
+        if (kit < 0 || kit >= size())
+            return {};
+
+        const auto* name = reinterpret_cast<const char*>(index.data() + (size_t) kit * indexEntryBytes);
+        return juce::String::fromUTF8(name, (int) strnlen(name, nameBytes));
+    }
+
+    // Message thread. Replaces the library with the file's contents; false if the file is missing
+    // or not a kit library (the library is left empty).
+    bool load(const juce::File& file)
+    {
+        count = 0;
+        storedVersion = 0;
+        storedTracks = 0;
+        storedFields = 0;
+        fieldMap.clear();
+        index.clear();
+        data.clear();
+
+        if (! file.existsAsFile())
+            return false;
+
+        juce::MemoryMappedFile mapped (file, juce::MemoryMappedFile::readOnly);
+        const auto* base = static_cast<const juce::uint8*>(mapped.getData());
+        const auto fileSize = mapped.getSize();
+
+        if (base == nullptr || fileSize < headerBytes || std::memcmp(base, magic, sizeof(magic)) != 0)
+            return false;
+
+        const auto version = readU32(base + 4);
+        const auto kits = readU32(base + 8);
+        const auto fields = readU32(base + 16);
+        const auto indexOffset = readU32(base + 20);
+        const auto dataOffset = readU32(base + 24);
+        const auto fieldTableOffset = readU32(base + 28);
+
+        if (version == 0 || version > (juce::uint32) formatVersion
+            || (size_t) indexOffset + (size_t) kits * indexEntryBytes > fileSize
+            || (size_t) dataOffset > fileSize)
+            return false;
+
+        if (version >= 3 && (fieldTableOffset < headerBytes || (size_t) fieldTableOffset + (size_t) fields * fieldNameBytes > fileSize))
+            return false;
+
+        // Where each stored field goes in the current layout (-1: dropped, or not a kit field).
+        fieldMap.assign(fields, -1);
+        for (juce::uint32 s = 0; s < fields; ++s)
+        {
+            int field = (int) s < ParameterIds::numTrackFields ? (int) s : -1;
+
+            if (version >= 3)
+            {
+                const auto* name = reinterpret_cast<const char*>(base + fieldTableOffset + (size_t) s * fieldNameBytes);
+                const std::string_view stored (name, strnlen(name, fieldNameBytes));
+
+                field = -1;
+                for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+                    if (stored == ParameterIds::trackFieldNames[f])
+                        field = f;
+            }
+
+            if (field >= 0 && isKitField((ParameterIds::TrackField) field))
+                fieldMap[s] = field;
+        }
+
+        index.assign(base + indexOffset, base + indexOffset + (size_t) kits * indexEntryBytes);
+        data.assign(reinterpret_cast<const juce::int8*>(base + dataOffset), reinterpret_cast<const juce::int8*>(base + fileSize));
+
+        count = kits;
+        storedVersion = version;
+        storedTracks = readU32(base + 12);
+        storedFields = fields;
+        return true;
+    }
+
+    // Message thread. Renames a kit in the file (reloading it first) and reloads the library.
+    bool rename(const juce::File& file, int kit, const juce::String& newName)
+    {
+        load(file);
+
+        if (kit < 0 || kit >= size())
+            return false;
+
+        return write(file, kit, newName, nullptr);
+    }
+
+    // Message thread. Appends the per-track sound of `state` (everything but the mutes) as a new kit
+    // to the file (reloading it first, so kits other instances saved meanwhile are kept) and reloads
+    // the library.
+    bool add(const juce::File& file, const juce::String& name, const StateCodec::Values& state)
+    {
+        load(file); // a missing file starts an empty library
+
+        std::array<juce::int8, valuesPerKit> kit {};
+        for (int t = 0; t < ParameterIds::numTracks; ++t)
+            for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+                kit[(size_t) (t * ParameterIds::numTrackFields + f)]
+                    = isKitField((ParameterIds::TrackField) f)
+                        ? (juce::int8) juce::jlimit(-127, 127, state[(size_t) ParameterIds::index(t, (ParameterIds::TrackField) f)])
+                        : notStored;
+
+        return write(file, -1, name, kit.data());
+    }
+
+    // Overwrites the per-track entries of `state` with the kit. Globals and mutes are left alone.
+    void applyTo(int kit, StateCodec::Values& state) const noexcept
+    {
+        std::array<juce::int8, valuesPerKit> values;
+        if (! read(kit, values.data()))
+            return;
+
+        for (int t = 0; t < ParameterIds::numTracks; ++t)
+            for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+            {
+                const auto v = values[(size_t) (t * ParameterIds::numTrackFields + f)];
+                if (v != notStored)
+                    state[(size_t) ParameterIds::index(t, (ParameterIds::TrackField) f)] = v;
+            }
+    }
+
+private:
+    static constexpr char magic[4] { 'M', 'C', 'Y', 'K' };
+    static constexpr size_t headerBytes = 32;
+    static constexpr size_t fieldNameBytes = 24;
+    static constexpr size_t indexEntryBytes = nameBytes + 8;
+    static constexpr size_t valuesPerKit = (size_t) ParameterIds::numTracks * ParameterIds::numTrackFields;
+
+    // Field not present in the file (saved before it existed): keep the current value.
+    static constexpr juce::int8 notStored = -128;
+
+    // Mutes belong to the performance, not to the kit.
+    static constexpr bool isKitField(ParameterIds::TrackField field) noexcept
+    {
+        return field != ParameterIds::unmuted;
+    }
+
+    static juce::uint32 readU32(const juce::uint8* p) noexcept
+    {
+        return juce::ByteOrder::littleEndianInt(p);
+    }
+
+    // One kit in the current track/field layout; fields the file doesn't have are notStored.
+    // False if the kit's index entry points outside the data block.
+    bool read(int kit, juce::int8* dest) const noexcept
+    {
+        if (kit < 0 || kit >= size())
+            return false;
+
+        const auto kitBytes = (size_t) storedTracks * storedFields;
+        const auto offset = (size_t) readU32(index.data() + (size_t) kit * indexEntryBytes + nameBytes);
+        if (offset + kitBytes > data.size())
+            return false;
+
+        std::fill(dest, dest + valuesPerKit, notStored);
+
+        // Copy the stored fields the current layout still has, to wherever they are now.
+        for (juce::uint32 t = 0; t < juce::jmin(storedTracks, (juce::uint32) ParameterIds::numTracks); ++t)
+            for (juce::uint32 s = 0; s < storedFields; ++s)
+                if (fieldMap[s] >= 0)
+                    dest[(size_t) t * ParameterIds::numTrackFields + (size_t) fieldMap[s]]
+                        = data[offset + (size_t) t * storedFields + s];
+
+        if (storedVersion < 2)
+            for (int t = 0; t < ParameterIds::numTracks; ++t)
+            {
+                auto& chance = dest[t * ParameterIds::numTrackFields + ParameterIds::chance];
+                if (chance != notStored)
+                    chance = (juce::int8) (127 - juce::jlimit(0, 127, (int) chance));
+            }
+
+        return true;
+    }
+
+    // Writes the loaded kits in the current layout, with `renamedKit` (if any) renamed to `name`
+    // or, when `addedKit` is given, a new kit called `name` appended. Then reloads the file.
+    bool write(const juce::File& file, int renamedKit, const juce::String& name, const juce::int8* addedKit)
+    {
+        const auto total = count + (addedKit != nullptr ? 1u : 0u);
+        const auto fieldTableOffset = (juce::uint32) headerBytes;
+        const auto indexOffset = fieldTableOffset + (juce::uint32) (ParameterIds::numTrackFields * fieldNameBytes);
+        const auto dataOffset = indexOffset + total * (juce::uint32) indexEntryBytes;
+
+        juce::MemoryBlock block;
+        juce::MemoryOutputStream out (block, false);
+
+        out.write(magic, sizeof(magic));
+        for (const auto v : { (juce::uint32) formatVersion, total, (juce::uint32) ParameterIds::numTracks,
+                              (juce::uint32) ParameterIds::numTrackFields, indexOffset, dataOffset, fieldTableOffset })
+            out.writeInt((int) v);
+
+        for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+        {
+            char fieldName[fieldNameBytes] {};
+            std::strncpy(fieldName, ParameterIds::trackFieldNames[f], fieldNameBytes - 1);
+            out.write(fieldName, fieldNameBytes);
+        }
+
+        for (juce::uint32 k = 0; k < total; ++k)
+        {
+            const bool useNewName = (int) k == renamedKit || k == count;
+
+            char entryName[nameBytes] {};
+            (useNewName ? name : getName((int) k)).copyToUTF8(entryName, nameBytes);
+            entryName[nameBytes - 1] = 0;
+
+            out.write(entryName, nameBytes);
+            out.writeInt((int) (k * valuesPerKit));
+            out.writeInt(0);
+        }
+
+        std::array<juce::int8, valuesPerKit> values;
+        for (juce::uint32 k = 0; k < count; ++k)
+        {
+            if (! read((int) k, values.data()))
+                values.fill(notStored);
+
+            out.write(values.data(), values.size());
+        }
+
+        if (addedKit != nullptr)
+            out.write(addedKit, valuesPerKit);
+
+        out.flush();
+
+        const bool written = file.getParentDirectory().createDirectory() && file.replaceWithData(block.getData(), block.getSize());
+        load(file);
+        return written;
+    }
+
+    // The file's index and data block as loaded, in the file's own track/field layout.
+    juce::uint32 count { 0 };
+    juce::uint32 storedVersion { 0 };
+    juce::uint32 storedTracks { 0 };
+    juce::uint32 storedFields { 0 };
+    std::vector<int> fieldMap;
+    std::vector<juce::uint8> index;
+    std::vector<juce::int8> data;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(KitLibrary)
+};
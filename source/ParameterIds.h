@@ -0,0 +1,148 @@
+#pragma once
+
+#include <string_view>
+
+// Compile-time parameter ID table.
+// Every ID is a string literal and every parameter has a dense index that equals its position in
+// the processor's parameter list, so code on any thread can address a parameter by integer instead
+// of concatenating "t" + track + "_" + suffix at runtime.
+//
+// The layout in PluginProcessor::createParameterLayout() is built from these lists, in this order.
+namespace ParameterIds
+{
+    constexpr int numTracks = 6;
+
+    // Global (not track-dependent) parameters.
+    #define MODELCYCLES_GLOBAL_PARAMETERS(X) \
+        X(patternBankGlobal)                 \
+        X(patternIndexGlobal)                \
+        X(mainVolumeGlobal)                  \
+        X(reverbSizeGlobal)                  \
+        X(delayTimeFreeGlobal)               \
+        X(delayTimeSyncEnabled)              \
+        X(delayTimeSyncIndexGlobal)          \
+        X(delaySendOverlayEnabled)           \
+        X(reverbSendOverlayEnabled)          \
+        X(panningOverlayEnabled)             \
+        X(delayFeedbackOverlay)              \
+        X(reverbToneOverlay)                 \
+        X(panningOverlay)                    \
+        X(patternChangeQuantum)              \
+        X(patternMorphBars)
+
+    // Per-track parameters, ID "t{N}_{field}".
+    #define MODELCYCLES_TRACK_FIELDS(X) \
+        X(unmuted)                      \
+        X(mixVolume)                    \
+        X(mixPan)                       \
+        X(machine)                      \
+        X(punch)                        \
+        X(pitch)                        \
+        X(pitchNote)                    \
+        X(decay)                        \
+        X(color)                        \
+        X(shape)                        \
+        X(gate)                         \
+        X(sweep)                        \
+        X(contour)                      \
+        X(delaySend)                    \
+        X(reverbSend)                   \
+        X(lfoMode)                      \
+        X(lfoSpeed)                     \
+        X(lfoMultiply)                  \
+        X(lfoWaveform)                  \
+        X(lfoPhase)                     \
+        X(lfoDepth)                     \
+        X(lfoDestination)               \
+        X(lfoFade)                      \
+        X(volDist)                      \
+        X(swing)                        \
+        X(chance)
+
+    #define MODELCYCLES_ENUM_ENTRY(name) name,
+    #define MODELCYCLES_STRING_ENTRY(name) #name,
+
+    enum GlobalParameter
+    {
+        MODELCYCLES_GLOBAL_PARAMETERS(MODELCYCLES_ENUM_ENTRY)
+        numGlobals
+    };
+
+    enum TrackField
+    {
+        MODELCYCLES_TRACK_FIELDS(MODELCYCLES_ENUM_ENTRY)
+        numTrackFields
+    };
+
+    constexpr int numParameters = numGlobals + numTracks * numTrackFields;
+
+    constexpr const char* globalIds[numGlobals] { MODELCYCLES_GLOBAL_PARAMETERS(MODELCYCLES_STRING_ENTRY) };
+
+    constexpr const char* trackFieldNames[numTrackFields] { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_STRING_ENTRY) };
+
+    #define MODELCYCLES_T1_ENTRY(name) "t1_" #name,
+    #define MODELCYCLES_T2_ENTRY(name) "t2_" #name,
+    #define MODELCYCLES_T3_ENTRY(name) "t3_" #name,
+    #define MODELCYCLES_T4_ENTRY(name) "t4_" #name,
+    #define MODELCYCLES_T5_ENTRY(name) "t5_" #name,
+    #define MODELCYCLES_T6_ENTRY(name) "t6_" #name,
+
+    // trackIds[track 0-5][field]
+    constexpr const char* trackIds[numTracks][numTrackFields] {
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T1_ENTRY) },
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T2_ENTRY) },
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T3_ENTRY) },
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T4_ENTRY) },
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T5_ENTRY) },
+        { MODELCYCLES_TRACK_FIELDS(MODELCYCLES_T6_ENTRY) },
+    };
+
+    #undef MODELCYCLES_T1_ENTRY
+    #undef MODELCYCLES_T2_ENTRY
+    #undef MODELCYCLES_T3_ENTRY
+    #undef MODELCYCLES_T4_ENTRY
+    #undef MODELCYCLES_T5_ENTRY
+    #undef MODELCYCLES_T6_ENTRY
+    #undef MODELCYCLES_ENUM_ENTRY
+    #undef MODELCYCLES_STRING_ENTRY
+
+    constexpr const char* globalId(GlobalParameter p) { return globalIds[p]; }
+
+    constexpr const char* trackId(int trackIndex0To5, TrackField field) { return trackIds[trackIndex0To5][field]; }
+
+    // Dense index == AudioProcessorParameter::getParameterIndex().
+    constexpr int index(GlobalParameter p) { return (int) p; }
+
+    constexpr int index(int trackIndex0To5, TrackField field)
+    {
+        return numGlobals + trackIndex0To5 * numTrackFields + (int) field;
+    }
+
+    constexpr bool isTrackIndex(int denseIndex) { return denseIndex >= numGlobals && denseIndex < numParameters; }
+
+    constexpr int trackOfIndex(int denseIndex) { return (denseIndex - numGlobals) / numTrackFields; }
+
+    constexpr TrackField fieldOfIndex(int denseIndex) { return (TrackField) ((denseIndex - numGlobals) % numTrackFields); }
+
+    // Dense index of an ID string, or -1. Linear in the list sizes; meant for decoding saved
+    // sessions, not for per-block use.
+    constexpr int indexOf(std::string_view id)
+    {
+        if (id.size() > 3 && id[0] == 't' && id[2] == '_' && id[1] >= '1' && id[1] < '1' + numTracks)
+        {
+            const auto field = id.substr(3);
+            for (int f = 0; f < numTrackFields; ++f)
+                if (field == trackFieldNames[f])
+                    return index(id[1] - '1', (TrackField) f);
+        }
+
+        for (int g = 0; g < numGlobals; ++g)
+            if (id == globalIds[g])
+                return g;
+
+        return -1;
+    }
+
+    static_assert(index(numTracks - 1, chance) == numParameters - 1, "dense index must cover the whole layout");
+    static_assert(indexOf("t2_decay") == index(1, decay) && indexOf("panningOverlay") == index(panningOverlay), "indexOf");
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <array>
+
+#include "ParameterIds.h"
+#include "TrackParameterSnapshot.h"
+
+// One full track parameter set per pattern slot (bank * 16 + pattern, 6 x 16 = 96 slots).
+// Every slot lives in a single preallocated block of int8 values (every per-track parameter fits
+// in -128..127), laid out slot-major in ParameterIds track/field order, so capturing or reading a
+// slot on the audio thread is a straight copy with no allocation or lookup.
+class PatternSnapshotStore final
+{
+public:
+    static constexpr int numBanks = 6;
+    static constexpr int patternsPerBank = 16;
+    static constexpr int numSlots = numBanks * patternsPerBank;
+    static constexpr int valuesPerSlot = ParameterIds::numTracks * ParameterIds::numTrackFields;
+
+    PatternSnapshotStore() = default;
+
+    static constexpr bool isValidSlot(int slot) noexcept { return slot >= 0 && slot < numSlots; }
+
+    bool has(int slot) const noexcept
+    {
+        return isValidSlot(slot) && stored[(size_t) slot] != 0;
+    }
+
+    void clear() noexcept
+    {
+        stored.fill(0);
+    }
+
+    // Audio thread. Stores the snapshot's current track values in the slot.
+    void capture(int slot, const TrackParameterSnapshot& params) noexcept
+    {
+        if (! isValidSlot(slot))
+            return;
+
+        auto* dest = values.data() + (size_t) slot * valuesPerSlot;
+        for (int t = 0; t < ParameterIds::numTracks; ++t)
+            for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+                dest[t * ParameterIds::numTrackFields + f]
+                    = (juce::int8) juce::jlimit(-128, 127, params.get((ParameterIds::TrackField) f, t));
+
+        stored[(size_t) slot] = 1;
+    }
+
+    // Stored value of one track field. Only meaningful if has(slot).
+    int get(int slot, int trackIndex0To5, ParameterIds::TrackField field) const noexcept
+    {
+        return values[(size_t) slot * valuesPerSlot + (size_t) (trackIndex0To5 * ParameterIds::numTrackFields + (int) field)];
+    }
+
+    // A slot's valuesPerSlot raw values in ParameterIds track/field order (state save/restore).
+    // Writing through slotData() does not mark the slot stored; call markStored() once it is filled.
+    const juce::int8* slotData(int slot) const noexcept { return values.data() + (size_t) slot * valuesPerSlot; }
+    juce::int8* slotData(int slot) noexcept { return values.data() + (size_t) slot * valuesPerSlot; }
+
+    void markStored(int slot) noexcept
+    {
+        if (isValidSlot(slot))
+            stored[(size_t) slot] = 1;
+    }
+
+    void copyFrom(const PatternSnapshotStore& other) noexcept
+    {
+        values = other.values;
+        stored = other.stored;
+    }
+
+private:
+    alignas(64) std::array<juce::int8, (size_t) numSlots * valuesPerSlot> values {};
+    std::array<juce::uint8, numSlots> stored {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternSnapshotStore)
+};
@@ -6,16 +6,57 @@
 #include <cmath>
 
 #include "ui_components/StudioStyle.h"
+#include "ui_components/UiScale.h"
 
-PluginEditor::PluginEditor (PluginProcessor& p)
-    : AudioProcessorEditor (&p), pluginProcessor (p)
+namespace
 {
     constexpr float dialScale = StudioStyle::Sizes::dialScale;
 
+    void initGreyDial(RotaryDial& d)
+    {
+        d.setUIScale(dialScale);
+        // Keep dial labels consistent across TRACK + MIX: raise by an extra 2px (after scaling).
+        // RotaryDial applies: labelRaisePx = round(labelRaiseBasePx * uiScale)
+        // so to add 2px on-screen we add (2 / uiScale) to the base.
+        d.setLabelRaisePx(StudioStyle::Sizes::dialLabelRaiseBasePx
+                          + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, d.getUIScale())));
+        d.setDialMode(RotaryDial::DialMode::UnipolarRing);
+        d.setRangeDisplay(RotaryDial::RangeDisplay::None);
+        d.getSlider().setRange(0.0, 127.0, 1.0);
+        d.getSlider().setNumDecimalPlacesToDisplay(0);
+        d.getSlider().setDoubleClickReturnValue(true, 0.0);
+        d.setRingThickness(StudioStyle::Sizes::dialRingThicknessPx * dialScale);
+        d.setValueFontHeight(StudioStyle::Sizes::dialValueFontHeightPx * dialScale);
+        d.setDialImageFromMemory(BinaryData::KnobGrey_png, BinaryData::KnobGrey_pngSize);
+        d.setLabelColour(juce::Colours::black);
+    }
+
+    void initWhiteDial(RotaryDial& d)
+    {
+        initGreyDial(d);
+        d.setDialImageFromMemory(BinaryData::KnobWhite_png, BinaryData::KnobWhite_pngSize);
+
+        // For white knobs (used by DELAY/REVERB), render the center value in the same grey as the arc.
+        d.getSlider().setColour(juce::Slider::textBoxTextColourId, juce::Colour(0xFF727676));
+    }
+
+    void initBlueDial(RotaryDial& d)
+    {
+        initGreyDial(d);
+        d.setDialImageFromMemory(BinaryData::KnobBlue_png, BinaryData::KnobBlue_pngSize);
+    }
+}
+
+PluginEditor::PluginEditor (PluginProcessor& p)
+    : AudioProcessorEditor (&p), pluginProcessor (p)
+{
     setLookAndFeel(&lookAndFeel);
 
     addAndMakeVisible(uiRoot);
 
+    // Right-clicking the panel background (not a control) offers to save the tracks as a kit.
+    uiRoot.addMouseListener(this, false);
+
     setResizable(true, true);
     setResizeLimits(juce::roundToInt((float) baseEditorWidthPx * 0.33f),
                     juce::roundToInt((float) baseEditorHeightPx * 0.33f),
@@ -82,19 +123,6 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     scalerCorner.setInterceptsMouseClicks(false, false);
     scalerCorner.setSvgFromMemory(BinaryData::Scaler_svg, BinaryData::Scaler_svgSize);
 
-    uiRoot.addAndMakeVisible(mixerOverlay);
-    mixerOverlay.setAlwaysOnTop(true);
-    mixerOverlay.setVisible(false);
-    mixerOverlay.setInterceptsMouseClicks(true, true);
-
-    for (auto* d : { &mixDelayFeedbackMini, &mixDelayTimeMini, &mixReverbToneMini, &mixReverbSizeMini })
-    {
-        mixerOverlay.addAndMakeVisible(*d);
-        d->setLabelYOffsetPx(StudioStyle::Sizes::overlayDialLabelYOffsetPx + 2);
-    }
-
-    mixerOverlay.addAndMakeVisible(mixDelayTimeSyncToggle);
-
     uiRoot.addAndMakeVisible(sweepControl);
     uiRoot.addAndMakeVisible(contourControl);
     uiRoot.addAndMakeVisible(delSendControl);
@@ -106,7 +134,6 @@ PluginEditor::PluginEditor (PluginProcessor& p)
 
     uiRoot.addAndMakeVisible(lfoSpeedControl);
     uiRoot.addAndMakeVisible(lfoSpeedOverlayToggle);
-    uiRoot.addAndMakeVisible(lfoOverlayPanel);
     uiRoot.addAndMakeVisible(volDistControl);
     uiRoot.addAndMakeVisible(swingControl);
     uiRoot.addAndMakeVisible(chanceControl);
@@ -128,47 +155,6 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     for (auto& c : trackMachineCombos)
         uiRoot.addAndMakeVisible(c);
 
-    // MIX overlay dials (6 tracks x 4 dials)
-    for (auto& s : mixTrackDials)
-    {
-        for (auto* d : { &s.volume, &s.pan, &s.delaySend, &s.reverbSend })
-            mixerOverlay.addAndMakeVisible(*d);
-    }
-
-    auto initGreyDial = [&](RotaryDial& d)
-    {
-        d.setUIScale(dialScale);
-        // Keep dial labels consistent across TRACK + MIX: raise by an extra 2px (after scaling).
-        // RotaryDial applies: labelRaisePx = round(labelRaiseBasePx * uiScale)
-        // so to add 2px on-screen we add (2 / uiScale) to the base.
-        d.setLabelRaisePx(StudioStyle::Sizes::dialLabelRaiseBasePx
-                          + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, d.getUIScale())));
-        d.setDialMode(RotaryDial::DialMode::UnipolarRing);
-        d.setRangeDisplay(RotaryDial::RangeDisplay::None);
-        d.getSlider().setRange(0.0, 127.0, 1.0);
-        d.getSlider().setNumDecimalPlacesToDisplay(0);
-        d.getSlider().setDoubleClickReturnValue(true, 0.0);
-        d.setRingThickness(StudioStyle::Sizes::dialRingThicknessPx * dialScale);
-        d.setValueFontHeight(StudioStyle::Sizes::dialValueFontHeightPx * dialScale);
-        d.setDialImageFromMemory(BinaryData::KnobGrey_png, BinaryData::KnobGrey_pngSize);
-        d.setLabelColour(juce::Colours::black);
-    };
-
-    auto initWhiteDial = [&](RotaryDial& d)
-    {
-        initGreyDial(d);
-        d.setDialImageFromMemory(BinaryData::KnobWhite_png, BinaryData::KnobWhite_pngSize);
-
-        // For white knobs (used by DELAY/REVERB), render the center value in the same grey as the arc.
-        d.getSlider().setColour(juce::Slider::textBoxTextColourId, juce::Colour(0xFF727676));
-    };
-
-    auto initBlueDial = [&](RotaryDial& d)
-    {
-        initGreyDial(d);
-        d.setDialImageFromMemory(BinaryData::KnobBlue_png, BinaryData::KnobBlue_pngSize);
-    };
-
     // PITCH: bipolar semitone control (per-track).
     pitchControl.setUIScale(dialScale);
     pitchControl.setDialMode(RotaryDial::DialMode::BipolarRing);
@@ -237,7 +223,7 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     mainVolumeControl.getSlider().setDoubleClickReturnValue(true, 100.0);
 
     mainVolumeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                              "mainVolumeGlobal",
+                                                              ParameterIds::globalId(ParameterIds::mainVolumeGlobal),
                                                               mainVolumeControl.getSlider());
 
     // Global pattern selection (BANK A-F + PATTERN 01-16)
@@ -273,10 +259,10 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     }
 
     patternBankAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                                 "patternBankGlobal",
+                                                                 ParameterIds::globalId(ParameterIds::patternBankGlobal),
                                                                  patternBankCombo);
     patternIndexAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                                  "patternIndexGlobal",
+                                                                  ParameterIds::globalId(ParameterIds::patternIndexGlobal),
                                                                   patternIndexCombo);
 
     gateToggle.setClickingTogglesState(true);
@@ -331,14 +317,14 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     trackButtons[0].setToggleState(true, juce::dontSendNotification);
 
     // Listen for per-track mute changes so we can update the button outline colour in TRACK mode.
+    // Registered on the parameters themselves, so changes arrive by dense index.
     for (int i = 0; i < 6; ++i)
-    {
-        const auto id = juce::String("t") + juce::String(i + 1) + "_unmuted";
-        pluginProcessor.apvts.addParameterListener(id, this);
-    }
+        if (auto* param = pluginProcessor.parameterAt(ParameterIds::index(i, ParameterIds::unmuted)))
+            param->addListener(this);
 
     // Initialise mute outlines.
-    parameterChanged("t1_unmuted", 0.0f);
+    for (int i = 0; i < 6; ++i)
+        refreshMuteOutline(i);
 
     // Track machine combo boxes (above track buttons)
     {
@@ -364,8 +350,9 @@ PluginEditor::PluginEditor (PluginProcessor& p)
             c.addItem("TONE", 5);
             c.addItem("CHORD", 6);
 
-            const auto paramId = juce::String("t") + juce::String((int) i + 1) + "_machine";
-            trackMachineAttachments[i] = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts, paramId, c);
+            trackMachineAttachments[i] = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
+                                                                             ParameterIds::trackId((int) i, ParameterIds::machine),
+                                                                             c);
 
             c.onChange = [this, i]
             {
@@ -482,8 +469,7 @@ PluginEditor::PluginEditor (PluginProcessor& p)
             if (! e.mods.isShiftDown())
                 return false;
 
-            const auto id = juce::String("t") + juce::String(i + 1) + "_unmuted";
-            if (auto* param = pluginProcessor.apvts.getParameter(id))
+            if (auto* param = pluginProcessor.parameterAt(ParameterIds::index(i, ParameterIds::unmuted)))
             {
                 const float current = param->getValue();
                 const float toggled = current >= 0.5f ? 0.0f : 1.0f;
@@ -492,8 +478,8 @@ PluginEditor::PluginEditor (PluginProcessor& p)
                 param->endChangeGesture();
             }
 
-            // Update outline immediately (parameterChanged is async).
-            parameterChanged(id, 0.0f);
+            // Update outline immediately (the listener path waits for the next timer tick).
+            refreshMuteOutline(i);
             return true;
         });
     }
@@ -523,14 +509,14 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     initWhiteDial(revSizeControl);
 
     reverbSizeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                              "reverbSizeGlobal",
+                                                              ParameterIds::globalId(ParameterIds::reverbSizeGlobal),
                                                               revSizeControl.getSlider());
 
     initWhiteDial(delayFeedbackOverlayControl);
     delayFeedbackOverlayControl.setAlwaysOnTop(true);
     delayFeedbackOverlayControl.setVisible(false);
     delayFeedbackOverlayAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                       "delayFeedbackOverlay",
+                                                                       ParameterIds::globalId(ParameterIds::delayFeedbackOverlay),
                                                                        delayFeedbackOverlayControl.getSlider());
 
     initGreyDial(lfoSpeedControl);
@@ -558,13 +544,13 @@ PluginEditor::PluginEditor (PluginProcessor& p)
 
     // Persist global overlay toggle states.
     panningOverlayEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                        "panningOverlayEnabled",
+                                                                        ParameterIds::globalId(ParameterIds::panningOverlayEnabled),
                                                                         mainVolumeOverlayToggle);
     delayOverlayEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                      "delaySendOverlayEnabled",
+                                                                      ParameterIds::globalId(ParameterIds::delaySendOverlayEnabled),
                                                                       delSendOverlayToggle);
     reverbOverlayEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                       "reverbSendOverlayEnabled",
+                                                                       ParameterIds::globalId(ParameterIds::reverbSendOverlayEnabled),
                                                                        revSendOverlayToggle);
 
     mainVolumeOverlayToggle.onStateChange = [this]
@@ -598,71 +584,29 @@ PluginEditor::PluginEditor (PluginProcessor& p)
         resized();
     };
 
-    lfoOverlayPanel.setAlwaysOnTop(true);
-    lfoOverlayPanel.setVisible(false);
-    lfoOverlayPanel.setInterceptsMouseClicks(true, true);
-    lfoOverlayPanel.setMiniDialUIScale(dialScale * 0.78f);
-    lfoOverlayPanel.setDialImageFromMemory(BinaryData::KnobGrey_png, BinaryData::KnobGrey_pngSize);
-    lfoOverlayPanel.setDesiredDialArcSidePx(48);
-
-    // Configure overlay dials per spec.
+    lfoSpeedOverlayToggle.onClick = [this]
     {
-        // MULTIPLY: unipolar with discrete labels.
-        auto& s = lfoOverlayPanel.getMultiplyDial().getSlider();
-        lfoOverlayPanel.getMultiplyDial().setDialMode(RotaryDial::DialMode::UnipolarRing);
-        s.setRange(0.0, 23.0, 1.0);
-        s.setNumDecimalPlacesToDisplay(0);
-
-        const juce::StringArray labels {
-            "x1", "x2", "x4", "x8", "x16", "x32", "x64", "x128", "x256", "x512", "x1k", "x2k",
-            "1",  "2",  "4",  "8",  "16",  "32",  "64",  "128",  "256",  "512",  "1k",  "2k"
-        };
-
-        s.textFromValueFunction = [labels](double v)
-        {
-            const int idx = juce::jlimit(0, labels.size() - 1, (int) std::lround(v));
-            return labels[idx];
-        };
-        s.valueFromTextFunction = [labels](const juce::String& t)
-        {
-            const int idx = labels.indexOf(t.trim());
-            return (double) (idx >= 0 ? idx : 0);
-        };
-        s.setDoubleClickReturnValue(true, 0.0);
+        const bool on = lfoSpeedOverlayToggle.getToggleState();
+        if (on && lfoOverlayPanel == nullptr)
+            createLfoOverlayPanel();
 
-        // DEPTH + FADE: bipolar -64..63.
-        for (auto* d : { &lfoOverlayPanel.getDepthDial(), &lfoOverlayPanel.getFadeDial() })
+        if (lfoOverlayPanel != nullptr)
         {
-            d->setDialMode(RotaryDial::DialMode::BipolarRing);
-            auto& ds = d->getSlider();
-            ds.setRange(-64.0, 63.0, 1.0);
-            ds.setNumDecimalPlacesToDisplay(0);
-            ds.setDoubleClickReturnValue(true, 0.0);
+            lfoOverlayPanel->setVisible(on);
+            if (on)
+                lfoOverlayPanel->toFront(false);
         }
-
-        // PHASE: keep unipolar 0..127 (not specified otherwise).
-        lfoOverlayPanel.getPhaseDial().setDialMode(RotaryDial::DialMode::UnipolarRing);
-        lfoOverlayPanel.getPhaseDial().getSlider().setRange(0.0, 127.0, 1.0);
-        lfoOverlayPanel.getPhaseDial().getSlider().setNumDecimalPlacesToDisplay(0);
-        lfoOverlayPanel.getPhaseDial().getSlider().setDoubleClickReturnValue(true, 0.0);
-    }
-
-    lfoSpeedOverlayToggle.onClick = [this]
-    {
-        const bool on = lfoSpeedOverlayToggle.getToggleState();
-        lfoOverlayPanel.setVisible(on);
-        if (on)
-            lfoOverlayPanel.toFront(false);
         resized();
     };
 
     initGreyDial(volDistControl);
     initGreyDial(swingControl);
     initGreyDial(chanceControl);
+    chanceControl.getSlider().setDoubleClickReturnValue(true, 127.0);
     initWhiteDial(delTimeControl);
 
     delayTimeFreeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                 "delayTimeFreeGlobal",
+                                                                 ParameterIds::globalId(ParameterIds::delayTimeFreeGlobal),
                                                                  delTimeControl.getSlider());
 
     initWhiteDial(delTimeSyncControl);
@@ -673,33 +617,15 @@ PluginEditor::PluginEditor (PluginProcessor& p)
             1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128
         };
 
+        // Value text comes from the attachment below: the parameter's choices are the step values.
         auto& s = delTimeSyncControl.getSlider();
         s.setRange(0.0, (double) (syncedValues.size() - 1), 1.0);
         s.setNumDecimalPlacesToDisplay(0);
-        s.textFromValueFunction = [](double v)
-        {
-            static constexpr std::array<int, 14> values {
-                1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128
-            };
-            const int i = juce::jlimit(0, (int) values.size() - 1, (int) std::lround(v));
-            return juce::String(values[(size_t) i]);
-        };
-        s.valueFromTextFunction = [](const juce::String& t)
-        {
-            const auto trimmed = t.trim();
-            static constexpr std::array<int, 14> values {
-                1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128
-            };
-            for (int i = 0; i < (int) values.size(); ++i)
-                if (trimmed == juce::String(values[(size_t) i]))
-                    return (double) i;
-            return 0.0;
-        };
         s.setDoubleClickReturnValue(true, 7.0);
     }
 
     delayTimeSyncIndexAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                     "delayTimeSyncIndexGlobal",
+                                                                     ParameterIds::globalId(ParameterIds::delayTimeSyncIndexGlobal),
                                                                      delTimeSyncControl.getSlider());
 
     // DELAY TIME sync toggle ("S")
@@ -713,7 +639,7 @@ PluginEditor::PluginEditor (PluginProcessor& p)
                                           BinaryData::BUTTON_ON_svg, BinaryData::BUTTON_ON_svgSize);
 
     delayTimeSyncEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                       "delayTimeSyncEnabled",
+                                                                       ParameterIds::globalId(ParameterIds::delayTimeSyncEnabled),
                                                                        delTimeSyncToggle);
 
     delTimeSyncToggle.onStateChange = [this]
@@ -727,168 +653,106 @@ PluginEditor::PluginEditor (PluginProcessor& p)
     reverbToneOverlayControl.setAlwaysOnTop(true);
     reverbToneOverlayControl.setVisible(false);
     reverbToneOverlayAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                     "reverbToneOverlay",
+                                                                     ParameterIds::globalId(ParameterIds::reverbToneOverlay),
                                                                      reverbToneOverlayControl.getSlider());
 
     updateDelayReverbSwapVisibility();
     updateMainVolumeSwapVisibility();
     updateDelayTimeSyncVisibility();
-    rebuildTrackAttachments();
-
-    // MIX overlay dials: 4 rows per track aligned with the footer track buttons.
-    for (int track = 0; track < 6; ++track)
-    {
-        auto& s = mixTrackDials[(size_t) track];
-
-        initBlueDial(s.volume);
-        s.volume.getSlider().setRange(0.0, 127.0, 1.0);
-        s.volume.getSlider().setNumDecimalPlacesToDisplay(0);
-        s.volume.getSlider().setDoubleClickReturnValue(true, 100.0);
-
-        initBlueDial(s.pan);
-        s.pan.setDialMode(RotaryDial::DialMode::BipolarRing);
-        s.pan.getSlider().setRange(-64.0, 63.0, 1.0);
-        s.pan.getSlider().setNumDecimalPlacesToDisplay(0);
-        s.pan.getSlider().setDoubleClickReturnValue(true, 0.0);
+    createTrackAttachments();
 
-        initWhiteDial(s.delaySend);
-        s.delaySend.getSlider().setRange(0.0, 127.0, 1.0);
-        s.delaySend.getSlider().setNumDecimalPlacesToDisplay(0);
-        s.delaySend.getSlider().setDoubleClickReturnValue(true, 0.0);
+    updateMixerOverlayVisibility();
 
-        initWhiteDial(s.reverbSend);
-        s.reverbSend.getSlider().setRange(0.0, 127.0, 1.0);
-        s.reverbSend.getSlider().setNumDecimalPlacesToDisplay(0);
-        s.reverbSend.getSlider().setDoubleClickReturnValue(true, 0.0);
+    setSize (baseEditorWidthPx, baseEditorHeightPx);
+}
 
-        const auto tn = juce::String(track + 1);
-        mixVolumeAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                                 "t" + tn + "_mixVolume",
-                                                                                 s.volume.getSlider());
-        mixPanAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                              "t" + tn + "_mixPan",
-                                                                              s.pan.getSlider());
+PluginEditor::~PluginEditor()
+{
+    cancelPendingUpdate();
+    stopTimer();
+    uiRoot.removeMouseListener(this);
 
-        // Reuse the existing per-track delay/reverb send parameters.
-        mixDelaySendAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                                    "t" + tn + "_delaySend",
-                                                                                    s.delaySend.getSlider());
-        mixReverbSendAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                                     "t" + tn + "_reverbSend",
-                                                                                     s.reverbSend.getSlider());
-    }
+    for (auto& c : trackMachineCombos)
+        c.setLookAndFeel(nullptr);
 
-    // MIX overlay mini dials (MIX column): same sizing/feel as LFO overlay dials.
-    {
-        const float miniScale = dialScale * 0.78f;
-        constexpr int arcSidePx = 48;
+    pitchNoteCombo.setLookAndFeel(nullptr);
+    patternBankCombo.setLookAndFeel(nullptr);
+    patternIndexCombo.setLookAndFeel(nullptr);
 
-        for (auto* d : { &mixDelayFeedbackMini, &mixDelayTimeMini, &mixReverbToneMini, &mixReverbSizeMini })
-        {
-            d->setUIScale(miniScale);
-            d->setArcSidePx(arcSidePx);
-            d->setDialMode(RotaryDial::DialMode::UnipolarRing);
-            d->setDialImageFromMemory(BinaryData::KnobWhite_png, BinaryData::KnobWhite_pngSize);
-            d->setLabelColour(juce::Colours::black);
+    for (int i = 0; i < 6; ++i)
+        if (auto* param = pluginProcessor.parameterAt(ParameterIds::index(i, ParameterIds::unmuted)))
+            param->removeListener(this);
 
-            // Match the arc grey for value text on white knobs.
-            d->getSlider().setColour(juce::Slider::textBoxTextColourId, juce::Colour(0xFF727676));
-        }
+    setLookAndFeel(nullptr);
+}
 
-        mixDelayFeedbackMini.getSlider().setRange(0.0, 127.0, 1.0);
-        mixDelayFeedbackMini.getSlider().setNumDecimalPlacesToDisplay(0);
-        mixDelayFeedbackMini.getSlider().setDoubleClickReturnValue(true, 0.0);
-        mixDelayFeedbackAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                        "delayFeedbackOverlay",
-                                                                        mixDelayFeedbackMini.getSlider());
+void PluginEditor::mouseDown(const juce::MouseEvent& e)
+{
+    if (! e.mods.isPopupMenu())
+        return;
 
-        mixDelayTimeMini.getSlider().setRange(0.0, 127.0, 1.0);
-        mixDelayTimeMini.getSlider().setNumDecimalPlacesToDisplay(0);
-        mixDelayTimeMini.getSlider().setDoubleClickReturnValue(true, 0.0);
-        // Attachment will be swapped between free time and sync index in updateMixDelayTimeSyncBinding().
+    juce::PopupMenu menu;
+    menu.setLookAndFeel(&lookAndFeel);
+    menu.addItem(1, "Save tracks as new kit");
 
-        mixReverbToneMini.getSlider().setRange(0.0, 127.0, 1.0);
-        mixReverbToneMini.getSlider().setNumDecimalPlacesToDisplay(0);
-        mixReverbToneMini.getSlider().setDoubleClickReturnValue(true, 0.0);
-        mixReverbToneAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                     "reverbToneOverlay",
-                                                                     mixReverbToneMini.getSlider());
-
-        mixReverbSizeMini.getSlider().setRange(0.0, 127.0, 1.0);
-        mixReverbSizeMini.getSlider().setNumDecimalPlacesToDisplay(0);
-        mixReverbSizeMini.getSlider().setDoubleClickReturnValue(true, 64.0);
-        mixReverbSizeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                     "reverbSizeGlobal",
-                                                                     mixReverbSizeMini.getSlider());
-    }
+    // The kit becomes the last program; hosts can rename it through their program list.
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&uiRoot).withMousePosition(),
+                       [safeThis = juce::Component::SafePointer<PluginEditor>(this)] (int result)
+                       {
+                           if (safeThis == nullptr || result != 1)
+                               return;
 
-    // MIX delay time sync toggle ("S")
-    mixDelayTimeSyncToggle.setClickingTogglesState(true);
-    mixDelayTimeSyncToggle.setCornerRadius(4.0f);
-    mixDelayTimeSyncToggle.setAlwaysOnTop(true);
-    mixDelayTimeSyncToggle.setGlyphText("S");
-    mixDelayTimeSyncToggle.setGlyphColour(juce::Colours::white);
-    mixDelayTimeSyncToggle.setGlyphFont(StudioStyle::Fonts::condensedBold(12.0f));
-    mixDelayTimeSyncToggle.setImagesFromMemory(BinaryData::BUTTON_OFF_svg, BinaryData::BUTTON_OFF_svgSize,
-                                               BinaryData::BUTTON_ON_svg, BinaryData::BUTTON_ON_svgSize);
+                           auto& processor = safeThis->pluginProcessor;
+                           processor.saveTracksAsKit("Kit " + juce::String(processor.getNumPrograms()));
+                       });
+}
 
-    // Same parameter as the normal page sync toggle.
-    mixDelayTimeSyncEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                           "delayTimeSyncEnabled",
-                                                                           mixDelayTimeSyncToggle);
+void PluginEditor::parameterValueChanged(int parameterIndex, float newValue)
+{
+    juce::ignoreUnused(newValue);
 
-    // Ensure the MIX TIME dial is bound correctly for the current sync state.
-    updateMixDelayTimeSyncBinding();
+    // Only the t{N}_unmuted parameters are listened to; the index is the dense ParameterIds index.
+    if (! ParameterIds::isTrackIndex(parameterIndex) || ParameterIds::fieldOfIndex(parameterIndex) != ParameterIds::unmuted)
+        return;
 
-    mixDelayTimeSyncToggle.onStateChange = [this]
-    {
-        updateDelayTimeSyncVisibility();
-        updateMixDelayTimeSyncBinding();
-        resized();
-    };
+    const int track = ParameterIds::trackOfIndex(parameterIndex);
 
-    updateMixerOverlayVisibility();
+    // Only the change that makes the mask non-empty needs to wake the timer.
+    if (dirtyMuteTracks.fetch_or(1u << track, std::memory_order_relaxed) == 0)
+        triggerAsyncUpdate();
+}
 
-    setSize (baseEditorWidthPx, baseEditorHeightPx);
+void PluginEditor::parameterGestureChanged(int parameterIndex, bool gestureIsStarting)
+{
+    juce::ignoreUnused(parameterIndex, gestureIsStarting);
 }
 
-PluginEditor::~PluginEditor()
+void PluginEditor::handleAsyncUpdate()
 {
-    for (auto& c : trackMachineCombos)
-        c.setLookAndFeel(nullptr);
+    if (! isTimerRunning())
+        startTimerHz(muteRefreshRateHz);
+}
 
-    pitchNoteCombo.setLookAndFeel(nullptr);
-    patternBankCombo.setLookAndFeel(nullptr);
-    patternIndexCombo.setLookAndFeel(nullptr);
+void PluginEditor::timerCallback()
+{
+    auto mask = dirtyMuteTracks.exchange(0, std::memory_order_relaxed);
 
-    for (int i = 0; i < 6; ++i)
+    // Nothing arrived since the last tick: idle until the next change.
+    if (mask == 0)
     {
-        const auto id = juce::String("t") + juce::String(i + 1) + "_unmuted";
-        pluginProcessor.apvts.removeParameterListener(id, this);
+        stopTimer();
+        return;
     }
 
-    setLookAndFeel(nullptr);
+    for (int i = 0; mask != 0; ++i, mask >>= 1)
+        if ((mask & 1u) != 0)
+            refreshMuteOutline(i);
 }
 
-void PluginEditor::parameterChanged(const juce::String& parameterID, float newValue)
+void PluginEditor::refreshMuteOutline(int trackIndex)
 {
-    juce::ignoreUnused(newValue);
-
-    if (! parameterID.endsWith("_unmuted"))
-        return;
-
-    juce::MessageManager::callAsync([this]
-    {
-        for (int i = 0; i < 6; ++i)
-        {
-            const auto id = juce::String("t") + juce::String(i + 1) + "_unmuted";
-            if (auto* v = pluginProcessor.apvts.getRawParameterValue(id))
-            {
-                const bool unmuted = v->load() >= 0.5f;
-                trackButtons[(size_t) i].setMuted(! unmuted);
-            }
-        }
-    });
+    if (auto* param = pluginProcessor.parameterAt(ParameterIds::index(trackIndex, ParameterIds::unmuted)))
+        trackButtons[(size_t) trackIndex].setMuted(param->getValue() < 0.5f);
 }
 
 void PluginEditor::syncToneColorValueComboToDial()
@@ -1024,63 +888,191 @@ void PluginEditor::updateDelayTimeSyncVisibility()
 
 void PluginEditor::updateMixDelayTimeSyncBinding()
 {
+    // Built with the MIX page; createMixerOverlay() binds it then.
+    if (mixerOverlay == nullptr)
+        return;
+
+    auto& mix = *mixerOverlay;
     const bool syncOn = delTimeSyncToggle.getToggleState();
 
-    if (syncOn == mixDelayTimeUsesSyncIndex && mixDelayTimeAttachment)
+    if (syncOn == mix.mixDelayTimeUsesSyncIndex && mix.mixDelayTimeAttachment)
         return;
 
     // Rebind the MIX TIME mini dial to the correct parameter.
-    mixDelayTimeAttachment.reset();
+    mix.mixDelayTimeAttachment.reset();
 
-    auto& s = mixDelayTimeMini.getSlider();
+    auto& s = mix.mixDelayTimeMini.getSlider();
 
     if (syncOn)
     {
-        // Match the main synced TIME dial behaviour: index 0..13 with musical labels.
-        static constexpr std::array<int, 14> values { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
-
-        s.setRange(0.0, (double) (values.size() - 1), 1.0);
+        // Match the main synced TIME dial behaviour: index 0..13, shown as the parameter's choices
+        // (the attachment installs their text).
+        s.setRange(0.0, 13.0, 1.0);
         s.setNumDecimalPlacesToDisplay(0);
-        s.textFromValueFunction = [](double v)
-        {
-            static constexpr std::array<int, 14> vls { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
-            const int i = juce::jlimit(0, (int) vls.size() - 1, (int) std::lround(v));
-            return juce::String(vls[(size_t) i]);
-        };
-        s.valueFromTextFunction = [](const juce::String& t)
-        {
-            const auto trimmed = t.trim();
-            static constexpr std::array<int, 14> vls { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
-            for (int i = 0; i < (int) vls.size(); ++i)
-                if (trimmed == juce::String(vls[(size_t) i]))
-                    return (double) i;
-            return 0.0;
-        };
         s.setDoubleClickReturnValue(true, 7.0);
 
-        mixDelayTimeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                    "delayTimeSyncIndexGlobal",
-                                                                    s);
+        mix.mixDelayTimeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                        ParameterIds::globalId(ParameterIds::delayTimeSyncIndexGlobal),
+                                                                        s);
     }
     else
     {
         // Free time: 0..127.
         s.setRange(0.0, 127.0, 1.0);
         s.setNumDecimalPlacesToDisplay(0);
-        s.textFromValueFunction = {};
-        s.valueFromTextFunction = {};
         s.setDoubleClickReturnValue(true, 0.0);
 
-        mixDelayTimeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                    "delayTimeFreeGlobal",
-                                                                    s);
+        mix.mixDelayTimeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                        ParameterIds::globalId(ParameterIds::delayTimeFreeGlobal),
+                                                                        s);
     }
 
-    mixDelayTimeUsesSyncIndex = syncOn;
+    mix.mixDelayTimeMini.invalidateValueText();
+    mix.mixDelayTimeUsesSyncIndex = syncOn;
+}
+
+void PluginEditor::createMixerOverlay()
+{
+    mixerOverlay = std::make_unique<MixerOverlay>();
+    auto& mix = *mixerOverlay;
+
+    uiRoot.addAndMakeVisible(mix);
+    mix.setAlwaysOnTop(true);
+    mix.setVisible(false);
+    mix.setInterceptsMouseClicks(true, true);
+
+    for (auto* d : { &mix.mixDelayFeedbackMini, &mix.mixDelayTimeMini, &mix.mixReverbToneMini, &mix.mixReverbSizeMini })
+    {
+        mix.addAndMakeVisible(*d);
+        d->setLabelYOffsetPx(StudioStyle::Sizes::overlayDialLabelYOffsetPx + 2);
+    }
+
+    mix.addAndMakeVisible(mix.mixDelayTimeSyncToggle);
+
+    // MIX overlay dials (6 tracks x 4 dials)
+    for (auto& s : mix.mixTrackDials)
+    {
+        for (auto* d : { &s.volume, &s.pan, &s.delaySend, &s.reverbSend })
+            mix.addAndMakeVisible(*d);
+    }
+
+    // MIX overlay dials: 4 rows per track aligned with the footer track buttons.
+    for (int track = 0; track < 6; ++track)
+    {
+        auto& s = mix.mixTrackDials[(size_t) track];
+
+        initBlueDial(s.volume);
+        s.volume.getSlider().setRange(0.0, 127.0, 1.0);
+        s.volume.getSlider().setNumDecimalPlacesToDisplay(0);
+        s.volume.getSlider().setDoubleClickReturnValue(true, 100.0);
+
+        initBlueDial(s.pan);
+        s.pan.setDialMode(RotaryDial::DialMode::BipolarRing);
+        s.pan.getSlider().setRange(-64.0, 63.0, 1.0);
+        s.pan.getSlider().setNumDecimalPlacesToDisplay(0);
+        s.pan.getSlider().setDoubleClickReturnValue(true, 0.0);
+
+        initWhiteDial(s.delaySend);
+        s.delaySend.getSlider().setRange(0.0, 127.0, 1.0);
+        s.delaySend.getSlider().setNumDecimalPlacesToDisplay(0);
+        s.delaySend.getSlider().setDoubleClickReturnValue(true, 0.0);
+
+        initWhiteDial(s.reverbSend);
+        s.reverbSend.getSlider().setRange(0.0, 127.0, 1.0);
+        s.reverbSend.getSlider().setNumDecimalPlacesToDisplay(0);
+        s.reverbSend.getSlider().setDoubleClickReturnValue(true, 0.0);
+
+        mix.mixVolumeAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                                     ParameterIds::trackId(track, ParameterIds::mixVolume),
+                                                                                     s.volume.getSlider());
+        mix.mixPanAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                                  ParameterIds::trackId(track, ParameterIds::mixPan),
+                                                                                  s.pan.getSlider());
+
+        // Reuse the existing per-track delay/reverb send parameters.
+        mix.mixDelaySendAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                                        ParameterIds::trackId(track, ParameterIds::delaySend),
+                                                                                        s.delaySend.getSlider());
+        mix.mixReverbSendAttachments[(size_t) track] = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                                         ParameterIds::trackId(track, ParameterIds::reverbSend),
+                                                                                         s.reverbSend.getSlider());
+    }
+
+    // MIX overlay mini dials (MIX column): same sizing/feel as LFO overlay dials.
+    {
+        const float miniScale = dialScale * 0.78f;
+        constexpr int arcSidePx = 48;
+
+        for (auto* d : { &mix.mixDelayFeedbackMini, &mix.mixDelayTimeMini, &mix.mixReverbToneMini, &mix.mixReverbSizeMini })
+        {
+            d->setUIScale(miniScale);
+            d->setArcSidePx(arcSidePx);
+            d->setDialMode(RotaryDial::DialMode::UnipolarRing);
+            d->setDialImageFromMemory(BinaryData::KnobWhite_png, BinaryData::KnobWhite_pngSize);
+            d->setLabelColour(juce::Colours::black);
+
+            // Match the arc grey for value text on white knobs.
+            d->getSlider().setColour(juce::Slider::textBoxTextColourId, juce::Colour(0xFF727676));
+        }
+
+        mix.mixDelayFeedbackMini.getSlider().setRange(0.0, 127.0, 1.0);
+        mix.mixDelayFeedbackMini.getSlider().setNumDecimalPlacesToDisplay(0);
+        mix.mixDelayFeedbackMini.getSlider().setDoubleClickReturnValue(true, 0.0);
+        mix.mixDelayFeedbackAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                            ParameterIds::globalId(ParameterIds::delayFeedbackOverlay),
+                                                                            mix.mixDelayFeedbackMini.getSlider());
+
+        mix.mixDelayTimeMini.getSlider().setRange(0.0, 127.0, 1.0);
+        mix.mixDelayTimeMini.getSlider().setNumDecimalPlacesToDisplay(0);
+        mix.mixDelayTimeMini.getSlider().setDoubleClickReturnValue(true, 0.0);
+        // Attachment will be swapped between free time and sync index in updateMixDelayTimeSyncBinding().
+
+        mix.mixReverbToneMini.getSlider().setRange(0.0, 127.0, 1.0);
+        mix.mixReverbToneMini.getSlider().setNumDecimalPlacesToDisplay(0);
+        mix.mixReverbToneMini.getSlider().setDoubleClickReturnValue(true, 0.0);
+        mix.mixReverbToneAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                         ParameterIds::globalId(ParameterIds::reverbToneOverlay),
+                                                                         mix.mixReverbToneMini.getSlider());
+
+        mix.mixReverbSizeMini.getSlider().setRange(0.0, 127.0, 1.0);
+        mix.mixReverbSizeMini.getSlider().setNumDecimalPlacesToDisplay(0);
+        mix.mixReverbSizeMini.getSlider().setDoubleClickReturnValue(true, 64.0);
+        mix.mixReverbSizeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
+                                                                         ParameterIds::globalId(ParameterIds::reverbSizeGlobal),
+                                                                         mix.mixReverbSizeMini.getSlider());
+    }
+
+    // MIX delay time sync toggle ("S")
+    mix.mixDelayTimeSyncToggle.setClickingTogglesState(true);
+    mix.mixDelayTimeSyncToggle.setCornerRadius(4.0f);
+    mix.mixDelayTimeSyncToggle.setAlwaysOnTop(true);
+    mix.mixDelayTimeSyncToggle.setGlyphText("S");
+    mix.mixDelayTimeSyncToggle.setGlyphColour(juce::Colours::white);
+    mix.mixDelayTimeSyncToggle.setGlyphFont(StudioStyle::Fonts::condensedBold(12.0f));
+    mix.mixDelayTimeSyncToggle.setImagesFromMemory(BinaryData::BUTTON_OFF_svg, BinaryData::BUTTON_OFF_svgSize,
+                                                   BinaryData::BUTTON_ON_svg, BinaryData::BUTTON_ON_svgSize);
+
+    // Same parameter as the normal page sync toggle.
+    mix.mixDelayTimeSyncEnabledAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
+                                                                               ParameterIds::globalId(ParameterIds::delayTimeSyncEnabled),
+                                                                               mix.mixDelayTimeSyncToggle);
+
+    // Ensure the MIX TIME dial is bound correctly for the current sync state.
+    updateMixDelayTimeSyncBinding();
+
+    mix.mixDelayTimeSyncToggle.onStateChange = [this]
+    {
+        updateDelayTimeSyncVisibility();
+        updateMixDelayTimeSyncBinding();
+        resized();
+    };
 }
 
 void PluginEditor::setMixerMode(bool shouldShowMixer)
 {
+    if (shouldShowMixer && mixerOverlay == nullptr)
+        createMixerOverlay();
+
     mixerMode = shouldShowMixer;
 
     if (mixerMode)
@@ -1092,9 +1084,8 @@ void PluginEditor::setMixerMode(bool shouldShowMixer)
         // Bind T1-T6 to per-track UNMUTED parameters.
         for (int i = 0; i < 6; ++i)
         {
-            const auto id = juce::String("t") + juce::String(i + 1) + "_unmuted";
             trackUnmutedAttachments[(size_t) i] = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                                                     id,
+                                                                                     ParameterIds::trackId(i, ParameterIds::unmuted),
                                                                                      trackButtons[(size_t) i]);
         }
 
@@ -1124,9 +1115,12 @@ void PluginEditor::updateMixerOverlayVisibility()
 {
     const bool on = mixerMode;
 
-    mixerOverlay.setVisible(on);
-    if (on)
-        mixerOverlay.toFront(false);
+    if (mixerOverlay != nullptr)
+    {
+        mixerOverlay->setVisible(on);
+        if (on)
+            mixerOverlay->toFront(false);
+    }
 
     // Pattern selector is visible in both modes and must stay above the MIX overlay.
     patternSelectBackdrop.setVisible(true);
@@ -1180,7 +1174,6 @@ void PluginEditor::updateMixerOverlayVisibility()
              (juce::Component*) &mainVolumeOverlayToggle,
              (juce::Component*) &delSendOverlayToggle,
              (juce::Component*) &revSendOverlayToggle,
-             (juce::Component*) &lfoOverlayPanel,
          })
     {
         comp->setVisible(showNormal);
@@ -1209,11 +1202,12 @@ void PluginEditor::updateMixerOverlayVisibility()
         updateDelayReverbSwapVisibility();
         updateMainVolumeSwapVisibility();
         updateDelayTimeSyncVisibility();
-        lfoOverlayPanel.setVisible(lfoSpeedOverlayToggle.getToggleState());
+        if (lfoOverlayPanel != nullptr)
+            lfoOverlayPanel->setVisible(lfoSpeedOverlayToggle.getToggleState());
     }
-    else
+    else if (lfoOverlayPanel != nullptr)
     {
-        lfoOverlayPanel.setVisible(false);
+        lfoOverlayPanel->setVisible(false);
     }
 }
 
@@ -1244,171 +1238,160 @@ void PluginEditor::setActiveTrack(int newTrackIndex)
     for (int i = 0; i < 6; ++i)
         trackButtons[(size_t) i].setToggleState(i == activeTrackIndex, juce::dontSendNotification);
 
-    rebuildTrackAttachments();
+    retargetTrackAttachments();
 }
 
-void PluginEditor::rebuildTrackAttachments()
+void PluginEditor::createTrackAttachments()
 {
-    auto trackParamId = [this](const juce::String& suffix)
+    trackAttachments.reserve(24);
+
+    auto slider = [&](ParameterIds::TrackField field, juce::Slider& s)
+    {
+        trackAttachments.push_back(std::make_unique<TrackSliderAttachment>(pluginProcessor, field, s));
+    };
+    auto button = [&](ParameterIds::TrackField field, juce::Button& b)
     {
-        return juce::String("t") + juce::String(activeTrackIndex + 1) + "_" + suffix;
+        trackAttachments.push_back(std::make_unique<TrackButtonAttachment>(pluginProcessor, field, b));
+    };
+    auto combo = [&](ParameterIds::TrackField field, juce::ComboBox& c)
+    {
+        trackAttachments.push_back(std::make_unique<TrackComboBoxAttachment>(pluginProcessor, field, c));
     };
 
-    // Destroy old attachments first to ensure we can rebind safely.
-    punchAttachment.reset();
-    gateAttachment.reset();
-        updateMachineDependentValueLabels();
-    lfoModeAttachment.reset();
-
-    pitchAttachment.reset();
-    pitchNoteAttachment.reset();
-    decayAttachment.reset();
-    colorAttachment.reset();
-    shapeAttachment.reset();
-    sweepAttachment.reset();
-    contourAttachment.reset();
-    delSendAttachment.reset();
-    revSendAttachment.reset();
-    lfoSpeedAttachment.reset();
-    lfoMultiplyAttachment.reset();
-    lfoWaveformAttachment.reset();
-    lfoPhaseAttachment.reset();
-    lfoDepthAttachment.reset();
-    lfoDestinationAttachment.reset();
-    lfoFadeAttachment.reset();
-    volDistAttachment.reset();
-    swingAttachment.reset();
-    chanceAttachment.reset();
-
-    trackMixVolumeAttachment.reset();
-    trackMixPanAttachment.reset();
-
-    punchAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("punch"),
-                                                         punchToggle);
-
-    pitchAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("pitch"),
-                                                         pitchControl.getSlider());
-
-    pitchNoteAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                               trackParamId("pitchNote"),
-                                                               pitchNoteCombo);
-
-    decayAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("decay"),
-                                                         decayControl.getSlider());
-
-    colorAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("color"),
-                                                         colorControl.getSlider());
-
-    shapeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("shape"),
-                                                         shapeControl.getSlider());
-
-    gateAttachment = std::make_unique<ButtonAttachment>(pluginProcessor.apvts,
-                                                        trackParamId("gate"),
-                                                        gateToggle);
-
-    sweepAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("sweep"),
-                                                         sweepControl.getSlider());
-
-    contourAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                           trackParamId("contour"),
-                                                           contourControl.getSlider());
-
-    delSendAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                           trackParamId("delaySend"),
-                                                           delSendControl.getSlider());
-
-    revSendAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                           trackParamId("reverbSend"),
-                                                           revSendControl.getSlider());
-
-    lfoModeAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                             trackParamId("lfoMode"),
-                                                             lfoModeButton.getComboBox());
-
-    lfoSpeedAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                            trackParamId("lfoSpeed"),
-                                                            lfoSpeedControl.getSlider());
-
-    // LFO overlay panel controls (track-dependent)
-    lfoMultiplyAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                               trackParamId("lfoMultiply"),
-                                                               lfoOverlayPanel.getMultiplyDial().getSlider());
-
-    lfoWaveformAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                                 trackParamId("lfoWaveform"),
-                                                                 lfoOverlayPanel.getWaveformCombo());
-
-    lfoPhaseAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                            trackParamId("lfoPhase"),
-                                                            lfoOverlayPanel.getPhaseDial().getSlider());
-
-    lfoDepthAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                            trackParamId("lfoDepth"),
-                                                            lfoOverlayPanel.getDepthDial().getSlider());
-
-    lfoDestinationAttachment = std::make_unique<ComboBoxAttachment>(pluginProcessor.apvts,
-                                                                    trackParamId("lfoDestination"),
-                                                                    lfoOverlayPanel.getDestinationCombo());
-
-    lfoFadeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                           trackParamId("lfoFade"),
-                                                           lfoOverlayPanel.getFadeDial().getSlider());
-
-    volDistAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                           trackParamId("volDist"),
-                                                           volDistControl.getSlider());
-
-    swingAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                         trackParamId("swing"),
-                                                         swingControl.getSlider());
-
-    chanceAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                          trackParamId("chance"),
-                                                          chanceControl.getSlider());
+    button(ParameterIds::punch, punchToggle);
+    slider(ParameterIds::pitch, pitchControl.getSlider());
+    combo(ParameterIds::pitchNote, pitchNoteCombo);
+    slider(ParameterIds::decay, decayControl.getSlider());
+    slider(ParameterIds::color, colorControl.getSlider());
+    slider(ParameterIds::shape, shapeControl.getSlider());
+    button(ParameterIds::gate, gateToggle);
+    slider(ParameterIds::sweep, sweepControl.getSlider());
+    slider(ParameterIds::contour, contourControl.getSlider());
+    slider(ParameterIds::delaySend, delSendControl.getSlider());
+    slider(ParameterIds::reverbSend, revSendControl.getSlider());
+    combo(ParameterIds::lfoMode, lfoModeButton.getComboBox());
+    slider(ParameterIds::lfoSpeed, lfoSpeedControl.getSlider());
+
+    slider(ParameterIds::volDist, volDistControl.getSlider());
+    slider(ParameterIds::swing, swingControl.getSlider());
+    slider(ParameterIds::chance, chanceControl.getSlider());
 
     // Track-mode VOLUME/PAN are the same parameters as the MIX page per-track controls.
-    trackMixVolumeAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                                  trackParamId("mixVolume"),
-                                                                  trackVolumeControl.getSlider());
+    slider(ParameterIds::mixVolume, trackVolumeControl.getSlider());
+    slider(ParameterIds::mixPan, trackPanControl.getSlider());
+
+    retargetTrackAttachments();
+}
+
+void PluginEditor::createLfoOverlayPanel()
+{
+    lfoOverlayPanel = std::make_unique<LfoOverlayPanel>();
+    uiRoot.addChildComponent(*lfoOverlayPanel);
+
+    lfoOverlayPanel->setAlwaysOnTop(true);
+    lfoOverlayPanel->setVisible(false);
+    lfoOverlayPanel->setInterceptsMouseClicks(true, true);
+    lfoOverlayPanel->setMiniDialUIScale(dialScale * 0.78f);
+    lfoOverlayPanel->setDialImageFromMemory(BinaryData::KnobGrey_png, BinaryData::KnobGrey_pngSize);
+    lfoOverlayPanel->setDesiredDialArcSidePx(48);
+
+    // Configure overlay dials per spec.
+    {
+        // MULTIPLY: unipolar with discrete labels.
+        auto& s = lfoOverlayPanel->getMultiplyDial().getSlider();
+        lfoOverlayPanel->getMultiplyDial().setDialMode(RotaryDial::DialMode::UnipolarRing);
+        s.setRange(0.0, 23.0, 1.0);
+        s.setNumDecimalPlacesToDisplay(0);
+
+        const juce::StringArray labels {
+            "x1", "x2", "x4", "x8", "x16", "x32", "x64", "x128", "x256", "x512", "x1k", "x2k",
+            "1",  "2",  "4",  "8",  "16",  "32",  "64",  "128",  "256",  "512",  "1k",  "2k"
+        };
+
+        s.textFromValueFunction = [labels](double v)
+        {
+            const int idx = juce::jlimit(0, labels.size() - 1, (int) std::lround(v));
+            return labels[idx];
+        };
+        s.valueFromTextFunction = [labels](const juce::String& t)
+        {
+            const int idx = labels.indexOf(t.trim());
+            return (double) (idx >= 0 ? idx : 0);
+        };
+        s.setDoubleClickReturnValue(true, 0.0);
+
+        // DEPTH + FADE: bipolar -64..63.
+        for (auto* d : { &lfoOverlayPanel->getDepthDial(), &lfoOverlayPanel->getFadeDial() })
+        {
+            d->setDialMode(RotaryDial::DialMode::BipolarRing);
+            auto& ds = d->getSlider();
+            ds.setRange(-64.0, 63.0, 1.0);
+            ds.setNumDecimalPlacesToDisplay(0);
+            ds.setDoubleClickReturnValue(true, 0.0);
+        }
+
+        // PHASE: keep unipolar 0..127 (not specified otherwise).
+        lfoOverlayPanel->getPhaseDial().setDialMode(RotaryDial::DialMode::UnipolarRing);
+        lfoOverlayPanel->getPhaseDial().getSlider().setRange(0.0, 127.0, 1.0);
+        lfoOverlayPanel->getPhaseDial().getSlider().setNumDecimalPlacesToDisplay(0);
+        lfoOverlayPanel->getPhaseDial().getSlider().setDoubleClickReturnValue(true, 0.0);
+    }
+
+    // Its controls join the track attachments, showing the active track.
+    auto attach = [this](std::unique_ptr<TrackParameterAttachment> a)
+    {
+        a->setTrack(activeTrackIndex);
+        trackAttachments.push_back(std::move(a));
+    };
 
-    trackMixPanAttachment = std::make_unique<SliderAttachment>(pluginProcessor.apvts,
-                                                               trackParamId("mixPan"),
-                                                               trackPanControl.getSlider());
+    attach(std::make_unique<TrackSliderAttachment>(pluginProcessor, ParameterIds::lfoMultiply, lfoOverlayPanel->getMultiplyDial().getSlider()));
+    attach(std::make_unique<TrackComboBoxAttachment>(pluginProcessor, ParameterIds::lfoWaveform, lfoOverlayPanel->getWaveformCombo()));
+    attach(std::make_unique<TrackSliderAttachment>(pluginProcessor, ParameterIds::lfoPhase, lfoOverlayPanel->getPhaseDial().getSlider()));
+    attach(std::make_unique<TrackSliderAttachment>(pluginProcessor, ParameterIds::lfoDepth, lfoOverlayPanel->getDepthDial().getSlider()));
+    attach(std::make_unique<TrackComboBoxAttachment>(pluginProcessor, ParameterIds::lfoDestination, lfoOverlayPanel->getDestinationCombo()));
+    attach(std::make_unique<TrackSliderAttachment>(pluginProcessor, ParameterIds::lfoFade, lfoOverlayPanel->getFadeDial().getSlider()));
+}
+
+void PluginEditor::retargetTrackAttachments()
+{
+    for (auto& a : trackAttachments)
+        a->setTrack(activeTrackIndex);
+
+    updateMachineDependentValueLabels();
 }
 
 void PluginEditor::resized()
 {
-    // Layout at a fixed design size, then scale the whole UI uniformly.
-    uiRoot.setBounds(0, 0, baseEditorWidthPx, baseEditorHeightPx);
     const float sx = (float) getWidth()  / (float) baseEditorWidthPx;
     const float sy = (float) getHeight() / (float) baseEditorHeightPx;
     const float scale = juce::jmax(0.01f, juce::jmin(sx, sy));
     const float offsetX = ((float) getWidth()  - (float) baseEditorWidthPx  * scale) * 0.5f;
     const float offsetY = ((float) getHeight() - (float) baseEditorHeightPx * scale) * 0.5f;
-    uiRoot.setTransform(juce::AffineTransform::scale(scale).translated(offsetX, offsetY));
 
-    auto bounds = uiRoot.getLocalBounds().reduced(StudioStyle::Sizes::editorPaddingPx);
+    // Lay out at the window's real size: the sizes below are in 750x500 design pixels and go
+    // through px(); components scale their own geometry with UiScale::of() in their resized().
+    UiScale::set(uiRoot, scale);
+    uiRoot.setBounds(juce::Rectangle<float>(offsetX, offsetY,
+                                            (float) baseEditorWidthPx * scale,
+                                            (float) baseEditorHeightPx * scale).toNearestIntEdges());
 
-    constexpr float dialScale = StudioStyle::Sizes::dialScale;
-    const int preferredRowH = juce::roundToInt((float) StudioStyle::Sizes::rowHeightPx * dialScale);
+    const auto px = [scale] (float designPx) { return juce::roundToInt(designPx * scale); };
 
-    const int gap = StudioStyle::Sizes::columnGapPx;
+    auto bounds = uiRoot.getLocalBounds().reduced(px(StudioStyle::Sizes::editorPaddingPx));
+
+    const int preferredRowH = px((float) StudioStyle::Sizes::rowHeightPx * dialScale);
+
+    const int gap = px(StudioStyle::Sizes::columnGapPx);
 
     // Compute 4-row layout based on available height so rows 1-3 are always equal.
     // Keep things a bit tighter than the old preferred sizing.
     const int totalH = bounds.getHeight();
-    const int trackRowH = juce::jlimit(50, preferredRowH, juce::roundToInt((float) totalH * 0.19f));
-    const int machineRowHForSizing = juce::jlimit(18, 30, juce::roundToInt((float) trackRowH * 0.36f));
+    const int trackRowH = juce::jlimit(px(50), preferredRowH, juce::roundToInt((float) totalH * 0.19f));
+    const int machineRowHForSizing = juce::jlimit(px(18), px(30), juce::roundToInt((float) trackRowH * 0.36f));
     const int controlsHWithMachine = juce::jmax(0, totalH - trackRowH - machineRowHForSizing - 2 * gap);
-    const int rowH2 = juce::jmax(40, controlsHWithMachine / 3);
+    const int rowH2 = juce::jmax(px(40), controlsHWithMachine / 3);
     // Keep row 1–3 equal by adding +10px per row band.
-    const int rowHControls = juce::jmax(40, rowH2 - 20 + 10);
+    const int rowHControls = juce::jmax(px(40), rowH2 - px(20) + px(10));
 
     // Row 4: track selectors (7 columns): T1-T6, then MIX.
     constexpr int trackCount = 7;
@@ -1448,17 +1431,17 @@ void PluginEditor::resized()
 
     // Ensure track buttons are bigger than the small toggle buttons (PUNCH/GATE/LFO).
     // Derive small toggle size from the same dial sizing math used below.
-    constexpr float minXGap = 6.0f;
-    const int dialSideForSizing = juce::jmin(preferredRowH, juce::jmax(30, (int) std::floor(step - minXGap)));
-    const float ringThicknessForSizing = StudioStyle::Sizes::dialRingThicknessPx * dialScale;
-    const float imagePaddingForSizing = ringThicknessForSizing + 6.0f;
+    const float minXGap = 6.0f * scale;
+    const int dialSideForSizing = juce::jmin(preferredRowH, juce::jmax(px(30), (int) std::floor(step - minXGap)));
+    const float ringThicknessForSizing = StudioStyle::Sizes::dialRingThicknessPx * dialScale * scale;
+    const float imagePaddingForSizing = ringThicknessForSizing + 6.0f * scale;
     const float dialImageSideForSizing = (float) dialSideForSizing - 2.0f * imagePaddingForSizing;
-    const int smallButtonSideForSizing = juce::jmax(24, juce::roundToInt(dialImageSideForSizing * StudioStyle::Sizes::buttonSizeVsDialImage));
+    const int smallButtonSideForSizing = juce::jmax(px(24), juce::roundToInt(dialImageSideForSizing * StudioStyle::Sizes::buttonSizeVsDialImage));
 
     // (Overlay sizing is tied to the *visible dial arc*; see further down after row 3 is laid out.)
 
-    const int maxTrackSideFromSlots = juce::jmax(26, (int) std::floor(slotW * 0.92f));
-    const int minTrackSide = juce::jmin(maxTrackSideFromSlots, smallButtonSideForSizing + 2);
+    const int maxTrackSideFromSlots = juce::jmax(px(26), (int) std::floor(slotW * 0.92f));
+    const int minTrackSide = juce::jmin(maxTrackSideFromSlots, smallButtonSideForSizing + px(2));
 
     int trackSide = juce::roundToInt((float) trackRowH * 0.56f * 1.3f);
     trackSide = juce::jlimit(minTrackSide, maxTrackSideFromSlots, trackSide);
@@ -1473,11 +1456,11 @@ void PluginEditor::resized()
     // Track machine combos: match track button width, smaller height/font, tucked close above buttons.
     {
         const int comboW = trackSide;
-        const int comboH = juce::jlimit(16, 22, machineRowArea.getHeight());
-        constexpr int gapToButtons = 4;
+        const int comboH = juce::jlimit(px(16), px(22), machineRowArea.getHeight());
+        const int gapToButtons = px(4);
 
-        constexpr int arrowW = 4;
-        constexpr int arrowH = 6;
+        const int arrowW = px(4);
+        const int arrowH = px(6);
 
         // Place combos relative to the *actual* track button Y so the visual gap is consistent
         // and much tighter than anchoring to the track-row band.
@@ -1491,7 +1474,7 @@ void PluginEditor::resized()
 
             // Small arrow at the left side of the machine combo (visual affordance).
             // Left edge aligned with the track button; vertically centred to the combo.
-            const int x = trackButtons[(size_t) i].getX() + 3;
+            const int x = trackButtons[(size_t) i].getX() + px(3);
             const int y = trackMachineCombos[(size_t) i].getBounds().getCentreY() - arrowH / 2;
             trackMachineArrows[(size_t) i].setBounds(x, y, arrowW, arrowH);
             trackMachineArrows[(size_t) i].toFront(false);
@@ -1508,14 +1491,14 @@ void PluginEditor::resized()
                          juce::Rectangle<int> rowBounds)
     {
         // Allow slightly larger dials by using a smaller minimum horizontal gap.
-        const int maxDialSideFromStep = juce::jmax(30, (int) std::floor(step - minXGap));
+        const int maxDialSideFromStep = juce::jmax(px(30), (int) std::floor(step - minXGap));
         // Keep content size independent of row height (row height only affects Y positioning).
         const int dialSide = juce::jmin(preferredRowH, maxDialSideFromStep);
 
-        const float ringThickness = StudioStyle::Sizes::dialRingThicknessPx * dialScale;
-        const float imagePadding = ringThickness + 6.0f;
+        const float ringThickness = StudioStyle::Sizes::dialRingThicknessPx * dialScale * scale;
+        const float imagePadding = ringThickness + 6.0f * scale;
         const float dialImageSide = (float) dialSide - 2.0f * imagePadding;
-        const int buttonSide = juce::jmax(24, juce::roundToInt(dialImageSide * StudioStyle::Sizes::buttonSizeVsDialImage));
+        const int buttonSide = juce::jmax(px(24), juce::roundToInt(dialImageSide * StudioStyle::Sizes::buttonSizeVsDialImage));
 
         const int dialY = rowBounds.getY() + (rowBounds.getHeight() - dialSide) / 2;
         const int buttonY = rowBounds.getY() + (rowBounds.getHeight() - buttonSide) / 2;
@@ -1560,18 +1543,18 @@ void PluginEditor::resized()
         // Centre Y: align to the PUNCH button centre.
         const auto dialImage = pitchControl.getSlider().getBounds().translated(pitchControl.getX(), pitchControl.getY());
 
-        const int baseH = juce::jlimit(18, 28, (int) std::lround((float) dialImage.getHeight() * 0.22f));
-        const int h = baseH + 10;
-        const int w = juce::jlimit(54, 92, (int) std::lround((float) dialImage.getWidth() * 0.62f));
-        const int overlap = juce::jlimit(6, 14, (int) std::lround((float) dialImage.getWidth() * 0.10f));
+        const int baseH = juce::jlimit(px(18), px(28), (int) std::lround((float) dialImage.getHeight() * 0.22f));
+        const int h = baseH + px(10);
+        const int w = juce::jlimit(px(54), px(92), (int) std::lround((float) dialImage.getWidth() * 0.62f));
+        const int overlap = juce::jlimit(px(6), px(14), (int) std::lround((float) dialImage.getWidth() * 0.10f));
 
         // Right edge slightly under the PITCH dial arc.
         const int rightEdge = dialImage.getX() + overlap;
-        const int x = (rightEdge - w) + 20;
+        const int x = (rightEdge - w) + px(20);
         const int y = punchToggle.getBounds().getCentreY() - h / 2;
 
         pitchNoteBackdrop.setBounds(x, y, w, h);
-        pitchNoteCombo.setBounds(pitchNoteBackdrop.getBounds().reduced(3));
+        pitchNoteCombo.setBounds(pitchNoteBackdrop.getBounds().reduced(px(3)));
 
         // Ensure the PITCH dial draws over the right edge of the note selector.
         pitchControl.toFront(false);
@@ -1579,21 +1562,20 @@ void PluginEditor::resized()
 
     // Machine-dependent value labels: overlay the dial label area for COLOR/SHAPE.
     {
-        auto placeOverDialLabel = [](RotaryDial& dial, juce::ComboBox& combo)
+        auto placeOverDialLabel = [&](RotaryDial& dial, juce::ComboBox& combo)
         {
             const auto dialBounds = dial.getBounds();
             const float uiScale = dial.getUIScale();
 
             // Mirror RotaryDial::resized() label geometry for LabelPlacement::Below.
             // This ensures the combo text sits exactly where the dial label text (COLOR/SHAPE) sits.
-            const int labelHeight = (int) juce::roundToInt((float) StudioStyle::Sizes::dialLabelAreaHeightPx * uiScale);
-            const int labelRaisePx = (int) juce::roundToInt(
-                (StudioStyle::Sizes::dialLabelRaiseBasePx
-                 + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, uiScale)))
-                * uiScale);
+            const int labelHeight = px(StudioStyle::Sizes::dialLabelAreaHeightPx * uiScale);
+            const int labelRaisePx = px((StudioStyle::Sizes::dialLabelRaiseBasePx
+                                         + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, uiScale)))
+                                        * uiScale);
 
             auto labelArea = dialBounds.withY(dialBounds.getBottom() - labelHeight).withHeight(labelHeight);
-            auto labelBounds = labelArea.translated(0, -labelRaisePx + StudioStyle::Sizes::dialLabelYOffsetPx);
+            auto labelBounds = labelArea.translated(0, -labelRaisePx + px(StudioStyle::Sizes::dialLabelYOffsetPx));
 
             combo.setBounds(labelBounds);
             combo.toFront(false);
@@ -1622,19 +1604,20 @@ void PluginEditor::resized()
 
     // Labels under PUNCH / GATE / LFO SHAPE: match dial label height/baseline.
     {
-        auto placeButtonLabelLikeDialLabel = [](juce::Component& button, juce::Label& label, RotaryDial& referenceDial)
+        auto placeButtonLabelLikeDialLabel = [&](juce::Component& button, juce::Label& label, RotaryDial& referenceDial)
         {
             const auto dialBounds = referenceDial.getBounds();
             const float uiScale = referenceDial.getUIScale();
 
-            const int labelHeight = (int) juce::roundToInt((float) StudioStyle::Sizes::dialLabelAreaHeightPx * uiScale);
-            const int labelRaisePx = (int) juce::roundToInt((float) StudioStyle::Sizes::dialLabelRaiseBasePx * uiScale
-                                                           + (float) StudioStyle::Sizes::dialLabelRaiseExtraPx);
+            const int labelHeight = px(StudioStyle::Sizes::dialLabelAreaHeightPx * uiScale);
+            const int labelRaisePx = px(StudioStyle::Sizes::dialLabelRaiseBasePx * uiScale
+                                        + StudioStyle::Sizes::dialLabelRaiseExtraPx);
 
             auto labelArea = dialBounds.withY(dialBounds.getBottom() - labelHeight).withHeight(labelHeight);
-            auto labelBounds = labelArea.translated(0, -labelRaisePx + StudioStyle::Sizes::dialLabelYOffsetPx);
+            auto labelBounds = labelArea.translated(0, -labelRaisePx + px(StudioStyle::Sizes::dialLabelYOffsetPx));
 
             label.setBounds(button.getX(), labelBounds.getY(), button.getWidth(), labelBounds.getHeight());
+            label.setFont(StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::dialLabel * scale));
         };
 
         placeButtonLabelLikeDialLabel(punchToggle, punchLabel, pitchControl);
@@ -1647,7 +1630,7 @@ void PluginEditor::resized()
             juce::GlyphArrangement ga;
             ga.addLineOfText(lfoShapeLabel.getFont(), lfoShapeLabel.getText(), 0.0f, 0.0f);
             const int textW = (int) std::ceil(ga.getBoundingBox(0, -1, true).getWidth());
-            const int desiredW = juce::jmax(current.getWidth(), textW + 12);
+            const int desiredW = juce::jmax(current.getWidth(), textW + px(12));
             const int clampedW = juce::jmin(desiredW, controlsArea.getWidth());
 
             int x = lfoModeButton.getBounds().getCentreX() - clampedW / 2;
@@ -1658,9 +1641,9 @@ void PluginEditor::resized()
 
     // Bottom-right scaler decoration.
     {
-        constexpr int scalerSize = 18;
-        constexpr int scalerMargin = 8;
-        constexpr int scalerNudge = 4;
+        const int scalerSize = px(18);
+        const int scalerMargin = px(8);
+        const int scalerNudge = px(4);
         scalerCorner.setBounds(uiRoot.getWidth() - scalerSize - scalerMargin,
                                uiRoot.getHeight() - scalerSize - scalerMargin,
                                scalerSize,
@@ -1684,13 +1667,13 @@ void PluginEditor::resized()
 
     // Overlay mini toggle: upper-left of the LFO SPEED dial (does not affect layout).
     {
-        constexpr int overlaySide = 16;
-        constexpr int overlayMargin = 4;
-        constexpr int overlayDownPx = 10;
+        const int overlaySide = px(16);
+        const int overlayMargin = px(4);
+        const int overlayDownPx = px(10);
 
         auto placeMiniToggle = [&](juce::Component& toggle, juce::Rectangle<int> dialBounds)
         {
-            const int x = dialBounds.getX() + overlayMargin + 5;
+            const int x = dialBounds.getX() + overlayMargin + px(5);
             const int y = dialBounds.getY() + overlayMargin + overlayDownPx;
             toggle.setBounds(x, y, overlaySide, overlaySide);
             toggle.toFront(false);
@@ -1705,8 +1688,9 @@ void PluginEditor::resized()
 
     // Overlay panel: covers VOLUME+DIST, SWING, CHANCE (3 columns) without changing layout.
     {
-        const bool on = lfoSpeedOverlayToggle.getToggleState();
-        lfoOverlayPanel.setVisible(on);
+        const bool on = lfoSpeedOverlayToggle.getToggleState() && lfoOverlayPanel != nullptr;
+        if (lfoOverlayPanel != nullptr)
+            lfoOverlayPanel->setVisible(on);
 
         if (on)
         {
@@ -1714,29 +1698,32 @@ void PluginEditor::resized()
             overlayBounds = overlayBounds.getUnion(swingControl.getBounds());
             overlayBounds = overlayBounds.getUnion(chanceControl.getBounds());
 
-            lfoOverlayPanel.setBounds(overlayBounds.expanded(2));
+            lfoOverlayPanel->setBounds(overlayBounds.expanded(px(2)));
             {
-                const auto b = lfoOverlayPanel.getBounds();
-                lfoOverlayPanel.setColumnCentresX(volDistControl.getBounds().getCentreX() - b.getX(),
+                const auto b = lfoOverlayPanel->getBounds();
+                lfoOverlayPanel->setColumnCentresX(volDistControl.getBounds().getCentreX() - b.getX(),
                                                   swingControl.getBounds().getCentreX() - b.getX(),
                                                   chanceControl.getBounds().getCentreX() - b.getX());
             }
-            lfoOverlayPanel.toFront(false);
+            lfoOverlayPanel->toFront(false);
         }
     }
 
     // MIX overlay: 4 rows (VOLUME, PAN, DELAY, REVERB) x 6 tracks, aligned to T1..T6.
     // In MIX mode we can also use the machine-row band as extra vertical space (machine combos are hidden).
     const auto mixOverlayArea = controlsArea.getUnion(machineRowArea);
-    mixerOverlay.setBounds(mixOverlayArea);
-    if (mixerMode)
+    if (mixerOverlay != nullptr)
+        mixerOverlay->setBounds(mixOverlayArea);
+
+    if (mixerMode && mixerOverlay != nullptr)
     {
+        auto& mix = *mixerOverlay;
         constexpr int rows = 4;
-        constexpr int mixRowsGlobalOffsetPx = 4; // requested: move all MIX big dials down by 4px
+        const int mixRowsGlobalOffsetPx = px(4); // requested: move all MIX big dials down by 4px
 
         // Use the same dial sizing as the normal (track) page, even though MIX has 4 rows.
         // We'll fit the extra row by tightening vertical spacing between rows.
-        const int maxDialSideFromStep = juce::jmax(30, (int) std::floor(step - minXGap));
+        const int maxDialSideFromStep = juce::jmax(px(30), (int) std::floor(step - minXGap));
         const int dialSide = juce::jmin(preferredRowH, maxDialSideFromStep);
 
         const int availableH = mixOverlayArea.getHeight();
@@ -1744,15 +1731,15 @@ void PluginEditor::resized()
 
         // Make the PAN->DELAY gap bigger than the others.
         // We compute step sizes so the last row still fits exactly within the overlay area.
-        const int desiredBigDelta = 18;
-        constexpr int extraGapPx = 6;
+        const int desiredBigDelta = px(18);
+        const int extraGapPx = px(6);
         const int spanForSteps = juce::jmax(0, maxSpan - 3 * extraGapPx);
         const int bigDelta = juce::jlimit(0, spanForSteps, desiredBigDelta);
         const int smallStep = (spanForSteps - bigDelta) / 3;
         const int bigStep = smallStep + bigDelta;
 
         const int y0 = 0;
-        constexpr int lowerRowsOffsetPx = 6; // PAN/DELAY/REVERB requested y +6
+        const int lowerRowsOffsetPx = px(6); // PAN/DELAY/REVERB requested y +6
         const int y1 = smallStep + extraGapPx;
         const int y2 = y1 + bigStep + extraGapPx;
         const int y3 = y2 + smallStep + extraGapPx;
@@ -1770,7 +1757,7 @@ void PluginEditor::resized()
             for (int t = 0; t < 6; ++t)
             {
                 const int cxLocal = trackCentresX[(size_t) t] - mixOverlayArea.getX();
-                auto& d = dialGetter(mixTrackDials[(size_t) t]);
+                auto& d = dialGetter(mix.mixTrackDials[(size_t) t]);
                 d.setBounds(cxLocal - dialSide / 2, y, dialSide, dialSide);
             }
         };
@@ -1784,12 +1771,12 @@ void PluginEditor::resized()
         {
             const float miniScale = dialScale * 0.78f;
             constexpr int arcSidePx = 48;
-            const int miniW = arcSidePx + 10;
-            const int miniLabelH = (int) juce::roundToInt(20.0f * miniScale);
-            const int miniGap = (int) juce::roundToInt(4.0f * miniScale);
+            const int miniW = px(arcSidePx + 10);
+            const int miniLabelH = px(20.0f * miniScale);
+            const int miniGap = px(4.0f * miniScale);
             const int miniH = miniW + miniLabelH + miniGap;
             // Tighten the gap between the two mini dials (requested: ~12px closer).
-            constexpr int miniPairGap = -4;
+            const int miniPairGap = px(-4);
 
             const int mixCxLocal = trackCentresX[(size_t) 6] - mixOverlayArea.getX();
             const int pairW = 2 * miniW + miniPairGap;
@@ -1809,57 +1796,57 @@ void PluginEditor::resized()
                 return juce::jlimit(0, maxTop, desiredTop);
             };
 
-            const int delayArcCentreY = getBigDialArcCentreY(mixTrackDials[0].delaySend);
-            const int reverbArcCentreY = getBigDialArcCentreY(mixTrackDials[0].reverbSend);
+            const int delayArcCentreY = getBigDialArcCentreY(mix.mixTrackDials[0].delaySend);
+            const int reverbArcCentreY = getBigDialArcCentreY(mix.mixTrackDials[0].reverbSend);
 
             const int delayY = clampMiniY(delayArcCentreY - miniW / 2);
             const int reverbY = clampMiniY(reverbArcCentreY - miniW / 2);
 
-            mixDelayFeedbackMini.setBounds(leftX, delayY, miniW, miniH);
-            mixDelayTimeMini.setBounds(rightX, delayY, miniW, miniH);
-            mixReverbToneMini.setBounds(leftX, reverbY, miniW, miniH);
-            mixReverbSizeMini.setBounds(rightX, reverbY, miniW, miniH);
+            mix.mixDelayFeedbackMini.setBounds(leftX, delayY, miniW, miniH);
+            mix.mixDelayTimeMini.setBounds(rightX, delayY, miniW, miniH);
+            mix.mixReverbToneMini.setBounds(leftX, reverbY, miniW, miniH);
+            mix.mixReverbSizeMini.setBounds(rightX, reverbY, miniW, miniH);
 
             // MIX delay sync toggle ("S"): overlay only, does not move any dials.
             // Requested placement: near top-left of TIME dial, centred between FEEDBACK and TIME.
-            constexpr int toggleSide = 16;
-            const int gapLeft = mixDelayFeedbackMini.getRight();
-            const int gapRight = mixDelayTimeMini.getX();
+            const int toggleSide = px(16);
+            const int gapLeft = mix.mixDelayFeedbackMini.getRight();
+            const int gapRight = mix.mixDelayTimeMini.getX();
             const int centreX = (gapLeft + gapRight) / 2;
             const int x = centreX - toggleSide / 2;
 
             // Align the toggle vertically with the DELAY dial label row.
             // (Match RotaryDial label layout; include the extra +2px raise used in initGreyDial.)
-            const auto delayDialBounds = mixTrackDials[0].delaySend.getBounds();
-            const float delayUiScale = mixTrackDials[0].delaySend.getUIScale();
+            const auto delayDialBounds = mix.mixTrackDials[0].delaySend.getBounds();
+            const float delayUiScale = mix.mixTrackDials[0].delaySend.getUIScale();
 
-            const int labelHeight = (int) juce::roundToInt(StudioStyle::Sizes::dialLabelAreaHeightPx * delayUiScale);
-            const int labelRaisePx = (int) juce::roundToInt((StudioStyle::Sizes::dialLabelRaiseBasePx
-                                                            + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, delayUiScale)))
-                                                           * delayUiScale);
-            constexpr int labelYOffsetPx = StudioStyle::Sizes::dialLabelYOffsetPx;
+            const int labelHeight = px(StudioStyle::Sizes::dialLabelAreaHeightPx * delayUiScale);
+            const int labelRaisePx = px((StudioStyle::Sizes::dialLabelRaiseBasePx
+                                         + (StudioStyle::Sizes::dialLabelRaiseExtraPx / juce::jmax(0.01f, delayUiScale)))
+                                        * delayUiScale);
+            const int labelYOffsetPx = px(StudioStyle::Sizes::dialLabelYOffsetPx);
 
             const auto labelArea = delayDialBounds.withY(delayDialBounds.getBottom() - labelHeight).withHeight(labelHeight);
             const auto labelBounds = labelArea.translated(0, -labelRaisePx + labelYOffsetPx);
 
-            const int y = labelBounds.getCentreY() - toggleSide / 2  - 62;
-            mixDelayTimeSyncToggle.setBounds(x, y, toggleSide, toggleSide);
-            mixDelayTimeSyncToggle.toFront(false);
+            const int y = labelBounds.getCentreY() - toggleSide / 2  - px(62);
+            mix.mixDelayTimeSyncToggle.setBounds(x, y, toggleSide, toggleSide);
+            mix.mixDelayTimeSyncToggle.toFront(false);
         }
 
-        mixerOverlay.toFront(false);
+        mix.toFront(false);
     }
 
     // Ensure MIX mode visibility rules win over normal overlay visibility logic above.
     // Global pattern selection: overlay. In MIX mode, position it after MIX dials are laid out.
     {
-        const int h = 34 + 10; // user request: PATTERN bank & number height +10
+        const int h = px(34 + 10); // user request: PATTERN bank & number height +10
         const int w = trackButtons[0].getWidth();
 
         constexpr int normalExtraUpPx = 10; // user request: normal mode up by 10px (combos + label)
         constexpr int mixerCombosDownPx = 0; // keep centred on PAN dial inner image
 
-        constexpr int yLiftPx = 20 + normalExtraUpPx;
+        const int yLiftPx = px(20 + normalExtraUpPx);
 
         int x = 0;
         int y = 0;
@@ -1870,7 +1857,7 @@ void PluginEditor::resized()
             const int cx = trackCentresX[6];
             x = cx - w / 2;
 
-            const int desiredY = trackButtons[6].getY() - h - 6;
+            const int desiredY = trackButtons[6].getY() - h - px(6);
             y = juce::jmax(0, desiredY);
         }
         else
@@ -1879,8 +1866,8 @@ void PluginEditor::resized()
             const int cx = mainVolumeControl.getBounds().getCentreX();
             x = cx - w / 2;
 
-            const auto panImageLocal = mixTrackDials[0].pan.getSlider().getBounds()
-                                           .translated(mixTrackDials[0].pan.getX(), mixTrackDials[0].pan.getY());
+            auto& pan = mixerOverlay->mixTrackDials[0].pan;
+            const auto panImageLocal = pan.getSlider().getBounds().translated(pan.getX(), pan.getY());
             const int panCentreYGlobal = mixOverlayArea.getY() + panImageLocal.getCentreY();
             y = panCentreYGlobal - h / 2;
         }
@@ -1888,54 +1875,54 @@ void PluginEditor::resized()
         if (! mixerMode)
             y -= yLiftPx;
         else
-            y += mixerCombosDownPx;
+            y += px(mixerCombosDownPx);
 
         // TRACK mode: nudge the whole selector down (background + combos + caption).
         if (! mixerMode)
-            y += 7;
+            y += px(7);
 
         patternSelectBackdrop.setBounds(x, y, w, h);
 
-        auto inner = patternSelectBackdrop.getBounds().reduced(3, 4);
+        auto inner = patternSelectBackdrop.getBounds().reduced(px(3), px(4));
         const int innerGap = 0;
-        const int bankW = 30;
+        const int bankW = px(30);
 
         auto bank = inner.removeFromLeft(bankW);
         inner.removeFromLeft(innerGap);
         auto idx = inner;
 
         // Give the text more room (overlap is allowed) so we don't get "..." truncation.
-        auto bankBounds = bank.expanded(6, 0);
-        auto idxBounds = idx.expanded(10, 0).translated(-4, 0);
+        auto bankBounds = bank.expanded(px(6), 0);
+        auto idxBounds = idx.expanded(px(10), 0).translated(px(-4), 0);
 
         patternBankCombo.setBounds(bankBounds);
         patternIndexCombo.setBounds(idxBounds);
 
         // Caption: "PATTERN" below the PATTERN combo.
         {
-            const float uiScale = mixerMode ? mixTrackDials[0].pan.getUIScale()
+            const float uiScale = mixerMode ? mixerOverlay->mixTrackDials[0].pan.getUIScale()
                                             : StudioStyle::Sizes::dialScale;
 
             // Match RotaryDial label space (see RotaryDial.h) so the caption reads the same size.
-            int labelH = (int) juce::roundToInt(26.0f * uiScale);
+            int labelH = px(26.0f * uiScale);
 
-            int labelY = patternSelectBackdrop.getBottom() + 2;
+            int labelY = patternSelectBackdrop.getBottom() + px(2);
 
             if (mixerMode)
             {
                 // Align to PAN dial label Y.
-                const auto panDialBounds = mixTrackDials[0].pan.getBounds().translated(mixerOverlay.getX(), mixerOverlay.getY());
-                const float dialUiScale = mixTrackDials[0].pan.getUIScale();
+                const auto panDialBounds = mixerOverlay->mixTrackDials[0].pan.getBounds().translated(mixerOverlay->getX(), mixerOverlay->getY());
+                const float dialUiScale = mixerOverlay->mixTrackDials[0].pan.getUIScale();
 
                 // Match the actual RotaryDial label layout (see RotaryDial.h)
-                const int dialLabelHeight = (int) juce::roundToInt(StudioStyle::Sizes::dialLabelAreaHeightPx * dialUiScale);
-                const int dialLabelRaise = (int) juce::roundToInt(StudioStyle::Sizes::dialLabelRaiseBasePx * dialUiScale);
-                constexpr int dialLabelYOffsetPx = StudioStyle::Sizes::dialLabelYOffsetPx;
+                const int dialLabelHeight = px(StudioStyle::Sizes::dialLabelAreaHeightPx * dialUiScale);
+                const int dialLabelRaise = px(StudioStyle::Sizes::dialLabelRaiseBasePx * dialUiScale);
+                const int dialLabelYOffsetPx = px(StudioStyle::Sizes::dialLabelYOffsetPx);
 
                 const auto dialLabelArea = panDialBounds.withY(panDialBounds.getBottom() - dialLabelHeight).withHeight(dialLabelHeight);
                 const auto dialLabelBounds = dialLabelArea.translated(0, -dialLabelRaise + dialLabelYOffsetPx);
 
-                labelY = dialLabelBounds.getY() - 2;
+                labelY = dialLabelBounds.getY() - px(2);
                 labelH = dialLabelBounds.getHeight();
             }
 
@@ -1944,7 +1931,7 @@ void PluginEditor::resized()
             // Make the caption read a bit bolder/larger (+2px) without changing global label styling.
             {
                 // StudioLookAndFeel label font roughly uses (h * 0.8 + 2). RotaryDial then adds +2.
-                const float targetSize = juce::jlimit(10.0f, 28.0f, (float) labelH * 0.8f + 4.0f);
+                const float targetSize = juce::jlimit(10.0f * scale, 28.0f * scale, (float) labelH * 0.8f + 4.0f * scale);
                 patternCaptionLabel.setFont(StudioStyle::Fonts::condensedBold(targetSize));
             }
         }
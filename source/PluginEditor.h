@@ -3,9 +3,13 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_extra/juce_gui_extra.h>
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "ui_components/RotaryDial.h"
+#include "ui_components/CachedBackdrop.h"
 #include "ui_components/ImageToggle.h"
 #include "ui_components/LayeredMenuButton.h"
 #include "ui_components/TrackSelectorButton.h"
@@ -14,11 +18,16 @@
 #include "ui_components/LfoOverlayPanel.h"
 #include "ui_components/OverlayDial.h"
 #include "ui_components/StudioLookAndFeel.h"
+#include "ui_components/TrackParameterAttachment.h"
+#include "ui_components/UiScale.h"
+#include "ui_components/ValueTextCache.h"
 
 class PluginProcessor;
 
 class PluginEditor final : public juce::AudioProcessorEditor,
-                           private juce::AudioProcessorValueTreeState::Listener
+                           private juce::AudioProcessorParameter::Listener,
+                           private juce::AsyncUpdater,
+                           private juce::Timer
 {
 public:
     explicit PluginEditor (PluginProcessor&);
@@ -26,9 +35,21 @@ public:
 
     void paint (juce::Graphics&) override;
     void resized() override;
+    void mouseDown (const juce::MouseEvent&) override;
 
 private:
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
+    void handleAsyncUpdate() override;
+    void timerCallback() override;
+
+    // Mute outlines: parameterValueChanged (any thread) only sets the track's bit; the timer applies the
+    // whole mask at most once per frame, however many changes arrived in between. The timer only
+    // runs while there is something to apply: the first bit set on an empty mask starts it (via
+    // handleAsyncUpdate() on the message thread), and a tick that finds the mask empty stops it.
+    static constexpr int muteRefreshRateHz = 60;
+    std::atomic<juce::uint32> dirtyMuteTracks { 0 };
+    void refreshMuteOutline(int trackIndex);
 
     PluginProcessor& pluginProcessor;
 
@@ -45,7 +66,16 @@ private:
     {
         void paint(juce::Graphics& g) override
         {
-            auto outer = getLocalBounds().toFloat();
+            const float uiScale = UiScale::of(*this);
+            backdrop.draw(g, getLocalBounds().toFloat(),
+                          [this, uiScale] (juce::Graphics& bg, juce::Rectangle<float> area) { paintBackdrop(bg, area, uiScale); });
+        }
+
+        void paintBackdrop(juce::Graphics& g, juce::Rectangle<float> outer, float uiScale) const
+        {
+            const float cornerPx = cornerRadiusPx * uiScale;
+            const float insetPx = 3.0f * uiScale;
+
 
             const auto light = StudioStyle::Colours::canvas.brighter(0.5f);
             const auto dark  = StudioStyle::Colours::canvas.darker(0.5f);
@@ -53,7 +83,7 @@ private:
             // Diagonal blend band: shift the left side down (+10) and the right side up (-20)
             // so the transition sits towards the lower-left and upper-right corners.
             const auto darkPoint  = outer.getTopLeft().translated(0.0f, 0.0f);
-            const auto lightPoint = outer.getBottomRight().translated(-40.0f,  0.0f);
+            const auto lightPoint = outer.getBottomRight().translated(-40.0f * uiScale, 0.0f);
 
             juce::ColourGradient grad(dark, darkPoint, light, lightPoint, false);
             constexpr double bandStart = 0.64;
@@ -63,30 +93,28 @@ private:
             grad.addColour(bandEnd, light);
             grad.addColour(1.00, light);
             g.setGradientFill(grad);
-            g.fillRoundedRectangle(outer, cornerRadiusPx);
+            g.fillRoundedRectangle(outer, cornerPx);
 
-            auto inner = outer.reduced(3.0f);
+            auto inner = outer.reduced(insetPx);
             // Match the LFO combo background so the inner fill reads as one control.
             g.setColour(juce::Colour(0xFFCEE5E8));
-            g.fillRoundedRectangle(inner, juce::jmax(0.0f, cornerRadiusPx - 3.0f));
+            g.fillRoundedRectangle(inner, juce::jmax(0.0f, cornerPx - insetPx));
         }
 
         float cornerRadiusPx { 7.0f };
+        CachedBackdrop backdrop;
     };
 
-    struct PatternComboLookAndFeel final : public juce::LookAndFeel_V4
+    struct PatternComboLookAndFeel final : public PopupScaledLookAndFeel
     {
         juce::Font getComboBoxFont(juce::ComboBox& box) override
         {
-            juce::ignoreUnused(box);
-            auto f = StudioStyle::Fonts::alphaComboTextFont();
-            f.setHeight(f.getHeight() + 4.0f);
-            return f;
+            return StudioStyle::Fonts::alphaSmartPlain((StudioStyle::Fonts::SizePx::alphaComboText + 4.0f) * UiScale::of(box));
         }
 
         juce::Font getPopupMenuFont() override
         {
-            return StudioStyle::Fonts::alphaComboMenuFont();
+            return StudioStyle::Fonts::alphaSmartPlain(StudioStyle::Fonts::SizePx::alphaComboMenu * popupScale);
         }
 
         void getIdealPopupMenuItemSize(const juce::String& text, bool isSeparator, int standardMenuItemHeight,
@@ -103,10 +131,7 @@ private:
             const int textW = juce::roundToInt(ga.getBoundingBox(0, -1, true).getWidth());
 
             // Make the menu tighter than the JUCE default.
-            constexpr int minW = 60;
-            constexpr int maxW = 120;
-            constexpr int padW = 34;
-            idealWidth = juce::jlimit(minW, maxW, textW + padW);
+            idealWidth = juce::jlimit(popupPx(60), popupPx(120), textW + popupPx(34));
         }
 
         void drawComboBox(juce::Graphics& g, int width, int height, bool,
@@ -120,7 +145,8 @@ private:
         {
             // Use almost the full bounds because this ComboBox is rendered text-only
             // (arrow/background/outline are intentionally hidden).
-            label.setBounds(box.getLocalBounds().translated(-2, 2));
+            const auto px = [scale = UiScale::of(box)] (float designPx) { return juce::roundToInt(designPx * scale); };
+            label.setBounds(box.getLocalBounds().translated(px(-2), px(2)));
             label.setFont(getComboBoxFont(box));
             label.setJustificationType(juce::Justification::centred);
             // Avoid JUCE scaling the font horizontally to fit.
@@ -151,16 +177,16 @@ private:
                 return;
             }
 
-            auto r = area.reduced(6, 2);
+            auto r = area.reduced(popupPx(6), popupPx(2));
             if (isTicked)
             {
                 g.setColour(selectedBg);
-                g.fillRoundedRectangle(r.toFloat(), 5.0f);
+                g.fillRoundedRectangle(r.toFloat(), 5.0f * popupScale);
             }
             else if (isHighlighted)
             {
                 g.setColour(textFg.withAlpha(0.12f));
-                g.fillRoundedRectangle(r.toFloat(), 5.0f);
+                g.fillRoundedRectangle(r.toFloat(), 5.0f * popupScale);
             }
 
             g.setColour(isTicked ? selectedFg : textFg);
@@ -186,7 +212,16 @@ private:
     {
         void paint(juce::Graphics& g) override
         {
-            auto outer = getLocalBounds().toFloat();
+            const float uiScale = UiScale::of(*this);
+            backdrop.draw(g, getLocalBounds().toFloat(),
+                          [this, uiScale] (juce::Graphics& bg, juce::Rectangle<float> area) { paintBackdrop(bg, area, uiScale); });
+        }
+
+        void paintBackdrop(juce::Graphics& g, juce::Rectangle<float> outer, float uiScale) const
+        {
+            const float cornerPx = cornerRadiusPx * uiScale;
+            const float insetPx = 3.0f * uiScale;
+
 
             const auto light = StudioStyle::Colours::canvas.brighter(0.5f);
             const auto dark  = StudioStyle::Colours::canvas.darker(0.5f);
@@ -201,7 +236,7 @@ private:
 
 
             const auto darkPoint  = outer.getTopLeft().translated(0.0f, 0.0f);
-            const auto lightPoint = outer.getBottomRight().translated(-40.0f,  0.0f);
+            const auto lightPoint = outer.getBottomRight().translated(-40.0f * uiScale, 0.0f);
 
             juce::ColourGradient grad(dark, darkPoint, light, lightPoint, false);
             constexpr double bandStart = 0.64;
@@ -211,27 +246,27 @@ private:
             grad.addColour(bandEnd, light);
             grad.addColour(1.00, light);
             g.setGradientFill(grad);
-            g.fillRoundedRectangle(outer, cornerRadiusPx);
+            g.fillRoundedRectangle(outer, cornerPx);
 
-            auto inner = outer.reduced(3.0f);
+            auto inner = outer.reduced(insetPx);
             g.setColour(StudioStyle::Colours::canvas.darker(0.05f));
-            g.fillRoundedRectangle(inner, juce::jmax(0.0f, cornerRadiusPx - 3.0f));
+            g.fillRoundedRectangle(inner, juce::jmax(0.0f, cornerPx - insetPx));
         }
 
         float cornerRadiusPx { 7.0f };
+        CachedBackdrop backdrop;
     };
 
-    struct PitchNoteComboLookAndFeel final : public juce::LookAndFeel_V4
+    struct PitchNoteComboLookAndFeel final : public PopupScaledLookAndFeel
     {
         juce::Font getComboBoxFont(juce::ComboBox& box) override
         {
-            juce::ignoreUnused(box);
-            return StudioStyle::Fonts::comboTextFont();
+            return StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::comboText * UiScale::of(box));
         }
 
         juce::Font getPopupMenuFont() override
         {
-            return StudioStyle::Fonts::comboMenuFont();
+            return StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::comboMenu * popupScale);
         }
 
         void getIdealPopupMenuItemSize(const juce::String& text, bool isSeparator, int standardMenuItemHeight,
@@ -248,10 +283,7 @@ private:
             const int textW = juce::roundToInt(ga.getBoundingBox(0, -1, true).getWidth());
 
             // Keep NOTE popup menus compact.
-            constexpr int minW = 74;
-            constexpr int maxW = 160;
-            constexpr int padW = 40;
-            idealWidth = juce::jlimit(minW, maxW, textW + padW);
+            idealWidth = juce::jlimit(popupPx(74), popupPx(160), textW + popupPx(40));
         }
 
         void drawComboBox(juce::Graphics& g, int width, int height, bool,
@@ -263,7 +295,8 @@ private:
 
         void positionComboBoxText(juce::ComboBox& box, juce::Label& label) override
         {
-            label.setBounds(box.getLocalBounds().reduced(6, 2).translated(-5, 0));
+            const auto px = [scale = UiScale::of(box)] (float designPx) { return juce::roundToInt(designPx * scale); };
+            label.setBounds(box.getLocalBounds().reduced(px(6), px(2)).translated(px(-5), 0));
             label.setFont(getComboBoxFont(box));
             label.setJustificationType(juce::Justification::centredLeft);
         }
@@ -293,19 +326,19 @@ private:
                 return;
             }
 
-            auto r = area.reduced(6, 2);
+            auto r = area.reduced(popupPx(6), popupPx(2));
 
             if (isTicked)
             {
                 // Make the selected row slightly bigger than highlight.
-                auto selectedR = area.reduced(4, 1);
+                auto selectedR = area.reduced(popupPx(4), popupPx(1));
                 g.setColour(selectedBg);
-                g.fillRoundedRectangle(selectedR.toFloat(), 6.0f);
+                g.fillRoundedRectangle(selectedR.toFloat(), 6.0f * popupScale);
             }
             else if (isHighlighted)
             {
                 g.setColour(normalFg.withAlpha(0.10f));
-                g.fillRoundedRectangle(r.toFloat(), 5.0f);
+                g.fillRoundedRectangle(r.toFloat(), 5.0f * popupScale);
             }
 
             g.setColour(isTicked ? selectedFg : normalFg);
@@ -322,15 +355,14 @@ private:
     RotaryDial colorControl { "COLOR", RotaryDial::LabelPlacement::Below };
     RotaryDial shapeControl { "SHAPE", RotaryDial::LabelPlacement::Below };
 
-    struct ValueLabelComboLookAndFeel final : public juce::LookAndFeel_V4
+    struct ValueLabelComboLookAndFeel final : public PopupScaledLookAndFeel
     {
         juce::Font getComboBoxFont(juce::ComboBox& box) override
         {
-            juce::ignoreUnused(box);
             // Dial labels are all-caps and read visually smaller than digits/mixed-case.
             // Use a slightly smaller size here so values like "MAJOR" and numbers match
             // the perceived height of the COLOR/SHAPE dial labels.
-            return StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::dialLabel - 2.0f);
+            return StudioStyle::Fonts::condensedBold((StudioStyle::Fonts::SizePx::dialLabel - 2.0f) * UiScale::of(box));
         }
 
         void drawComboBox(juce::Graphics& g, int width, int height, bool,
@@ -341,10 +373,29 @@ private:
             auto r = juce::Rectangle<int>(0, 0, width, height);
 
             g.setColour(box.findColour(juce::ComboBox::textColourId));
-            g.setFont(getComboBoxFont(box));
+            valueTexts->drawFittedText(g, selectedText(box), getComboBoxFont(box), r,
+                                       juce::Justification::centred);
+        }
+
+        // The interned text of the box's selected item, looked up again only when the selection
+        // changes (a box with nothing selected shows free text, which is interned as it is drawn).
+        const juce::String& selectedText(juce::ComboBox& box)
+        {
+            const int id = box.getSelectedId();
+            if (id == 0)
+            {
+                unselectedText = valueTexts->intern(box.getText());
+                return unselectedText;
+            }
 
-            const auto displayText = box.getText();
-            g.drawFittedText(displayText, r, juce::Justification::centred, 1);
+            auto& entry = selectedTexts[&box];
+            if (entry.itemId != id)
+            {
+                entry.itemId = id;
+                entry.text = valueTexts->intern(box.getItemText(box.getSelectedItemIndex()));
+            }
+
+            return entry.text;
         }
 
         void positionComboBoxText(juce::ComboBox& box, juce::Label& label) override
@@ -356,7 +407,7 @@ private:
 
         juce::Font getPopupMenuFont() override
         {
-            return StudioStyle::Fonts::comboMenuFont();
+            return StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::comboMenu * popupScale);
         }
 
         void drawPopupMenuBackground(juce::Graphics& g, int width, int height) override
@@ -380,14 +431,14 @@ private:
                 return;
             }
 
-            auto textBounds = area.reduced(6, 2);
+            auto textBounds = area.reduced(popupPx(6), popupPx(2));
 
             if (isTicked)
             {
                 // Inverted selected row (no tick prefix). Slightly bigger than the text bounds.
-                auto selectedBounds = area.reduced(4, 1);
+                auto selectedBounds = area.reduced(popupPx(4), popupPx(1));
                 g.setColour(textFg);
-                g.fillRoundedRectangle(selectedBounds.toFloat(), 6.0f);
+                g.fillRoundedRectangle(selectedBounds.toFloat(), 6.0f * popupScale);
                 g.setColour(menuBg);
             }
             else
@@ -395,7 +446,7 @@ private:
                 if (isHighlighted)
                 {
                     g.setColour(textFg.withAlpha(0.12f));
-                    g.fillRoundedRectangle(textBounds.toFloat(), 5.0f);
+                    g.fillRoundedRectangle(textBounds.toFloat(), 5.0f * popupScale);
                 }
                 g.setColour(textFg);
             }
@@ -406,6 +457,18 @@ private:
 
         juce::Colour menuBg { juce::Colour(0xFFCEE5E8) };
         juce::Colour textFg { juce::Colour(0xFF021616) };
+
+        // The combo text is drawn here rather than by its label, so it is shaped once per value.
+        juce::SharedResourcePointer<ValueTextCache> valueTexts;
+
+        struct SelectedText
+        {
+            int itemId { 0 };
+            juce::String text;
+        };
+
+        std::map<const juce::ComboBox*, SelectedText> selectedTexts;
+        juce::String unselectedText;
     };
 
     ValueLabelComboLookAndFeel valueLabelComboLookAndFeel;
@@ -435,16 +498,21 @@ private:
         void setSvgFromMemory(const void* data, int size)
         {
             drawable = juce::Drawable::createFromImageData(data, (size_t) size);
+            backdrop.invalidate();
             repaint();
         }
 
         void paint(juce::Graphics& g) override
         {
             if (drawable != nullptr)
-                drawable->drawWithin(g, getLocalBounds().toFloat(), juce::RectanglePlacement::centred, 1.0f);
+                backdrop.draw(g, getLocalBounds().toFloat(), [this] (juce::Graphics& bg, juce::Rectangle<float> area)
+                {
+                    drawable->drawWithin(bg, area, juce::RectanglePlacement::centred, 1.0f);
+                });
         }
 
         std::unique_ptr<juce::Drawable> drawable;
+        CachedBackdrop backdrop;
     };
 
     SvgDecor scalerCorner;
@@ -455,13 +523,6 @@ private:
     // Attachments are created only while MIX mode is active (track mode uses these buttons for selection).
     std::array<std::unique_ptr<ButtonAttachment>, 6> trackUnmutedAttachments;
 
-    struct MixerOverlay final : public juce::Component
-    {
-        void paint(juce::Graphics& g) override;
-    };
-
-    MixerOverlay mixerOverlay;
-
     struct MixTrackDials
     {
         RotaryDial volume { "VOLUME", RotaryDial::LabelPlacement::Below };
@@ -470,34 +531,42 @@ private:
         RotaryDial reverbSend { "REVERB", RotaryDial::LabelPlacement::Below };
     };
 
-    std::array<MixTrackDials, 6> mixTrackDials;
+    // MIX page: the overlay owns its dials and their attachments. It is built the first time MIX
+    // is shown (createMixerOverlay()), so sessions that never open MIX don't pay for it.
+    struct MixerOverlay final : public juce::Component
+    {
+        void paint(juce::Graphics& g) override;
+
+        std::array<MixTrackDials, 6> mixTrackDials;
 
-    std::array<std::unique_ptr<SliderAttachment>, 6> mixVolumeAttachments;
-    std::array<std::unique_ptr<SliderAttachment>, 6> mixPanAttachments;
-    std::array<std::unique_ptr<SliderAttachment>, 6> mixDelaySendAttachments;
-    std::array<std::unique_ptr<SliderAttachment>, 6> mixReverbSendAttachments;
+        // MIX column mini dials (aligned above the MIX button; same size as LFO overlay dials)
+        OverlayDial mixDelayFeedbackMini { "FEEDB." };
+        OverlayDial mixDelayTimeMini { "TIME" };
+        TextMiniToggle mixDelayTimeSyncToggle; // "S" toggle layered above the DELAY mini pair
+        OverlayDial mixReverbToneMini { "TONE" };
+        OverlayDial mixReverbSizeMini { "SIZE" };
 
-    // MIX column mini dials (aligned above the MIX button; same size as LFO overlay dials)
-    OverlayDial mixDelayFeedbackMini { "FEEDB." };
-    OverlayDial mixDelayTimeMini { "TIME" };
-    TextMiniToggle mixDelayTimeSyncToggle; // "S" toggle layered above the DELAY mini pair
-    OverlayDial mixReverbToneMini { "TONE" };
-    OverlayDial mixReverbSizeMini { "SIZE" };
+        std::array<std::unique_ptr<SliderAttachment>, 6> mixVolumeAttachments;
+        std::array<std::unique_ptr<SliderAttachment>, 6> mixPanAttachments;
+        std::array<std::unique_ptr<SliderAttachment>, 6> mixDelaySendAttachments;
+        std::array<std::unique_ptr<SliderAttachment>, 6> mixReverbSendAttachments;
 
-    std::unique_ptr<SliderAttachment> mixDelayFeedbackAttachment;
-    std::unique_ptr<SliderAttachment> mixDelayTimeAttachment;
-    std::unique_ptr<SliderAttachment> mixReverbToneAttachment;
-    std::unique_ptr<SliderAttachment> mixReverbSizeAttachment;
+        std::unique_ptr<SliderAttachment> mixDelayFeedbackAttachment;
+        std::unique_ptr<SliderAttachment> mixDelayTimeAttachment;
+        std::unique_ptr<SliderAttachment> mixReverbToneAttachment;
+        std::unique_ptr<SliderAttachment> mixReverbSizeAttachment;
 
-    std::unique_ptr<ButtonAttachment> mixDelayTimeSyncEnabledAttachment;
-    bool mixDelayTimeUsesSyncIndex { false };
+        std::unique_ptr<ButtonAttachment> mixDelayTimeSyncEnabledAttachment;
+        bool mixDelayTimeUsesSyncIndex { false };
+    };
 
-    struct TrackComboLookAndFeel final : public juce::LookAndFeel_V4
+    std::unique_ptr<MixerOverlay> mixerOverlay;
+
+    struct TrackComboLookAndFeel final : public PopupScaledLookAndFeel
     {
         juce::Font getComboBoxFont(juce::ComboBox& box) override
         {
-            juce::ignoreUnused(box);
-            return StudioStyle::Fonts::alphaComboTextSmallFont();
+            return StudioStyle::Fonts::alphaSmartPlain(StudioStyle::Fonts::SizePx::alphaComboTextSmall * UiScale::of(box));
         }
 
         void drawComboBox(juce::Graphics& g, int width, int height, bool,
@@ -509,11 +578,16 @@ private:
 
         void positionComboBoxText(juce::ComboBox& box, juce::Label& label) override
         {
-            label.setBounds(box.getLocalBounds().translated(0, 1));
+            label.setBounds(box.getLocalBounds().translated(0, juce::roundToInt(UiScale::of(box))));
             label.setFont(getComboBoxFont(box));
             label.setJustificationType(juce::Justification::centred);
         }
 
+        juce::Font getPopupMenuFont() override
+        {
+            return StudioStyle::Fonts::alphaSmartPlain(StudioStyle::Fonts::SizePx::alphaComboMenu * popupScale);
+        }
+
         void drawPopupMenuBackground(juce::Graphics& g, int width, int height) override
         {
             juce::ignoreUnused(width, height);
@@ -535,14 +609,14 @@ private:
                 return;
             }
 
-            auto textBounds = area.reduced(4, 1);
+            auto textBounds = area.reduced(popupPx(4), popupPx(1));
 
             if (isTicked)
             {
                 // Inverted selected row (no tick prefix). Slightly taller than the text bounds.
-                auto selectedBounds = area.reduced(4, 0);
+                auto selectedBounds = area.reduced(popupPx(4), 0);
                 g.setColour(textFg);
-                g.fillRoundedRectangle(selectedBounds.toFloat(), 5.0f);
+                g.fillRoundedRectangle(selectedBounds.toFloat(), 5.0f * popupScale);
 
                 g.setColour(menuBg);
             }
@@ -551,13 +625,13 @@ private:
                 if (isHighlighted)
                 {
                     g.setColour(textFg.withAlpha(0.12f));
-                    g.fillRoundedRectangle(textBounds.toFloat(), 5.0f);
+                    g.fillRoundedRectangle(textBounds.toFloat(), 5.0f * popupScale);
                 }
 
                 g.setColour(textFg);
             }
 
-            g.setFont(StudioStyle::Fonts::alphaComboMenuFont());
+            g.setFont(getPopupMenuFont());
             g.drawFittedText(text, textBounds, juce::Justification::centred, 1);
         }
 
@@ -603,7 +677,7 @@ private:
     // Row 3
     RotaryDial lfoSpeedControl { "LFO SPEED", RotaryDial::LabelPlacement::Below };
     OverlayMiniToggle lfoSpeedOverlayToggle;
-    LfoOverlayPanel lfoOverlayPanel;
+    std::unique_ptr<LfoOverlayPanel> lfoOverlayPanel; // built on first show (createLfoOverlayPanel())
     RotaryDial volDistControl { "VOLUME+DIST", RotaryDial::LabelPlacement::Below };
     RotaryDial swingControl { "SWING", RotaryDial::LabelPlacement::Below };
     RotaryDial chanceControl { "CHANCE", RotaryDial::LabelPlacement::Below };
@@ -628,49 +702,27 @@ private:
     std::unique_ptr<ButtonAttachment> panningOverlayEnabledAttachment;
     std::unique_ptr<ButtonAttachment> delayTimeSyncEnabledAttachment;
 
-    // Track-dependent attachments (re-created on track switch)
+    // Track-dependent attachments: created once, bound to all six tracks by dense index and
+    // re-pointed on track switch (see TrackParameterAttachment).
     int activeTrackIndex { 0 }; // 0..5
     bool mixerMode { false };
-    std::unique_ptr<ButtonAttachment> punchAttachment;
-    std::unique_ptr<ButtonAttachment> gateAttachment;
-    std::unique_ptr<ComboBoxAttachment> lfoModeAttachment;
-
-    std::unique_ptr<SliderAttachment> pitchAttachment;
-    std::unique_ptr<ComboBoxAttachment> pitchNoteAttachment;
-    std::unique_ptr<SliderAttachment> decayAttachment;
-    std::unique_ptr<SliderAttachment> colorAttachment;
-    std::unique_ptr<SliderAttachment> shapeAttachment;
-    std::unique_ptr<SliderAttachment> sweepAttachment;
-    std::unique_ptr<SliderAttachment> contourAttachment;
-    std::unique_ptr<SliderAttachment> delSendAttachment;
-    std::unique_ptr<SliderAttachment> revSendAttachment;
-    std::unique_ptr<SliderAttachment> lfoSpeedAttachment;
-    std::unique_ptr<SliderAttachment> lfoMultiplyAttachment;
-    std::unique_ptr<ComboBoxAttachment> lfoWaveformAttachment;
-    std::unique_ptr<SliderAttachment> lfoPhaseAttachment;
-    std::unique_ptr<SliderAttachment> lfoDepthAttachment;
-    std::unique_ptr<ComboBoxAttachment> lfoDestinationAttachment;
-    std::unique_ptr<SliderAttachment> lfoFadeAttachment;
-    std::unique_ptr<SliderAttachment> volDistAttachment;
-    std::unique_ptr<SliderAttachment> swingAttachment;
-    std::unique_ptr<SliderAttachment> chanceAttachment;
-
-    // Track-mode VOLUME/PAN in row 1 (bound to the same params as MIX page)
-    std::unique_ptr<SliderAttachment> trackMixVolumeAttachment;
-    std::unique_ptr<SliderAttachment> trackMixPanAttachment;
+    std::vector<std::unique_ptr<TrackParameterAttachment>> trackAttachments;
 
     void updateDelayReverbSwapVisibility();
     void updateMainVolumeSwapVisibility();
 
     void updateDelayTimeSyncVisibility();
     void updateMixDelayTimeSyncBinding();
+    void createMixerOverlay();
+    void createLfoOverlayPanel();
     void setMixerMode(bool shouldShowMixer);
     void updateMixerOverlayVisibility();
     void updateMachineDependentValueLabels();
     void syncToneColorValueComboToDial();
     void syncChordShapeValueComboToDial();
     void setActiveTrack(int newTrackIndex);
-    void rebuildTrackAttachments();
+    void createTrackAttachments();
+    void retargetTrackAttachments();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginEditor)
 };
@@ -3,6 +3,9 @@
 
 juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParameterLayout()
 {
+    namespace ids = ParameterIds;
+
+    // Added in ParameterIds order so every parameter's index matches its dense index.
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
 
     const auto pitchNoteChoices = []
@@ -28,109 +31,124 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParam
 
     // Global controls (not track-dependent)
     layout.add(std::make_unique<juce::AudioParameterChoice>(
-        juce::ParameterID { "patternBankGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::patternBankGlobal), 1 },
         "Pattern Bank",
         juce::StringArray { "A", "B", "C", "D", "E", "F" },
         0));
 
     layout.add(std::make_unique<juce::AudioParameterChoice>(
-        juce::ParameterID { "patternIndexGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::patternIndexGlobal), 1 },
         "Pattern",
         juce::StringArray { "01", "02", "03", "04", "05", "06", "07", "08", "09", "10", "11", "12", "13", "14", "15", "16" },
         0));
 
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "mainVolumeGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::mainVolumeGlobal), 1 },
         "Main Volume",
         0,
         127,
         100));
 
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "reverbSizeGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::reverbSizeGlobal), 1 },
         "Reverb Size",
         0,
         127,
         64));
 
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "delayTimeFreeGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::delayTimeFreeGlobal), 1 },
         "Delay Time",
         0,
         127,
         0));
 
     layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "delayTimeSyncEnabled", 1 },
+        juce::ParameterID { ids::globalId(ids::delayTimeSyncEnabled), 1 },
         "Delay Time Sync",
         false));
 
     layout.add(std::make_unique<juce::AudioParameterChoice>(
-        juce::ParameterID { "delayTimeSyncIndexGlobal", 1 },
+        juce::ParameterID { ids::globalId(ids::delayTimeSyncIndexGlobal), 1 },
         "Delay Time (Sync)",
         juce::StringArray { "1", "2", "3", "4", "6", "8", "12", "16", "24", "32", "48", "64", "96", "128" },
         7));
 
     // Global overlay toggles
     layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "delaySendOverlayEnabled", 1 },
+        juce::ParameterID { ids::globalId(ids::delaySendOverlayEnabled), 1 },
         "Delay Overlay Enabled",
         false));
 
     layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "reverbSendOverlayEnabled", 1 },
+        juce::ParameterID { ids::globalId(ids::reverbSendOverlayEnabled), 1 },
         "Reverb Overlay Enabled",
         false));
 
     layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "panningOverlayEnabled", 1 },
+        juce::ParameterID { ids::globalId(ids::panningOverlayEnabled), 1 },
         "Panning Overlay Enabled",
         false));
 
     // Overlay swap parameters (used when the mini toggles are enabled in the UI).
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "delayFeedbackOverlay", 1 },
+        juce::ParameterID { ids::globalId(ids::delayFeedbackOverlay), 1 },
         "Delay Feedb (Overlay)",
         0,
         127,
         0));
 
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "reverbToneOverlay", 1 },
+        juce::ParameterID { ids::globalId(ids::reverbToneOverlay), 1 },
         "Reverb Tone (Overlay)",
         0,
         127,
         0));
 
     layout.add(std::make_unique<juce::AudioParameterInt>(
-        juce::ParameterID { "panningOverlay", 1 },
+        juce::ParameterID { ids::globalId(ids::panningOverlay), 1 },
         "Panning (Overlay)",
         -64,
         63,
         0));
 
+    // When a Pattern Bank / Pattern change is sent to the device (see PatternChangeEngine).
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { ids::globalId(ids::patternChangeQuantum), 1 },
+        "Pattern Change Quantum",
+        juce::StringArray { "BEAT", "BAR", "2 BARS", "4 BARS" },
+        1));
+
+    // Bars over which a pattern change morphs the tracks to that pattern's snapshot; OFF recalls it at once
+    // (see PatternMorphEngine).
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { ids::globalId(ids::patternMorphBars), 1 },
+        "Pattern Morph",
+        juce::StringArray { "OFF", "1 BAR", "2 BARS", "4 BARS", "8 BARS" },
+        0));
+
     // Per-track controls (tracks 1-6)
     for (int track = 1; track <= 6; ++track)
     {
-        const auto prefix = "t" + juce::String(track) + "_";
+        const int t = track - 1;
 
         // MIX footer track button state (MUTE/UNMUTE) when MIX mode is active.
         // True means the track is *unmuted* (button lit). Default: all unmuted.
         layout.add(std::make_unique<juce::AudioParameterBool>(
-            juce::ParameterID { prefix + "unmuted", 1 },
+            juce::ParameterID { ids::trackId(t, ids::unmuted), 1 },
             "Unmuted (T" + juce::String(track) + ")",
             true));
 
         // MIX page controls (shown when MIX footer button is enabled)
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "mixVolume", 1 },
+            juce::ParameterID { ids::trackId(t, ids::mixVolume), 1 },
             "Mix Volume (T" + juce::String(track) + ")",
             0,
             127,
             100));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "mixPan", 1 },
+            juce::ParameterID { ids::trackId(t, ids::mixPan), 1 },
             "Mix Pan (T" + juce::String(track) + ")",
             -64,
             63,
@@ -138,35 +156,35 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParam
 
         // Track machine selector (shown above each track button)
         layout.add(std::make_unique<juce::AudioParameterChoice>(
-            juce::ParameterID { prefix + "machine", 1 },
+            juce::ParameterID { ids::trackId(t, ids::machine), 1 },
             "Machine (T" + juce::String(track) + ")",
             juce::StringArray { "KICK", "SNARE", "METAL", "PERC", "TONE", "CHORD" },
             0));
 
         // Row 1 (col 1-5): PUNCH + PITCH/DECAY/COLOR/SHAPE
         layout.add(std::make_unique<juce::AudioParameterBool>(
-            juce::ParameterID { prefix + "punch", 1 },
+            juce::ParameterID { ids::trackId(t, ids::punch), 1 },
             "Punch (T" + juce::String(track) + ")",
             false));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "pitch", 1 },
+            juce::ParameterID { ids::trackId(t, ids::pitch), 1 },
             "Pitch (T" + juce::String(track) + ")",
             -24,
             24,
             0));
 
         layout.add(std::make_unique<juce::AudioParameterChoice>(
-            juce::ParameterID { prefix + "pitchNote", 1 },
+            juce::ParameterID { ids::trackId(t, ids::pitchNote), 1 },
             "Pitch Note (T" + juce::String(track) + ")",
             pitchNoteChoices,
             0));
 
-        for (auto name : { "decay", "color", "shape" })
+        for (auto field : { ids::decay, ids::color, ids::shape })
         {
             layout.add(std::make_unique<juce::AudioParameterInt>(
-                juce::ParameterID { prefix + name, 1 },
-                juce::String(name).toUpperCase() + " (T" + juce::String(track) + ")",
+                juce::ParameterID { ids::trackId(t, field), 1 },
+                juce::String(ids::trackFieldNames[field]).toUpperCase() + " (T" + juce::String(track) + ")",
                 0,
                 127,
                 0));
@@ -174,15 +192,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParam
 
         // Row 2 (col 1-5): GATE + SWEEP/CONTOUR/DELAY SEND/REVERB SEND
         layout.add(std::make_unique<juce::AudioParameterBool>(
-            juce::ParameterID { prefix + "gate", 1 },
+            juce::ParameterID { ids::trackId(t, ids::gate), 1 },
             "Gate (T" + juce::String(track) + ")",
             false));
 
-        for (auto name : { "sweep", "contour", "delaySend", "reverbSend" })
+        for (auto field : { ids::sweep, ids::contour, ids::delaySend, ids::reverbSend })
         {
             layout.add(std::make_unique<juce::AudioParameterInt>(
-                juce::ParameterID { prefix + name, 1 },
-                juce::String(name).toUpperCase() + " (T" + juce::String(track) + ")",
+                juce::ParameterID { ids::trackId(t, field), 1 },
+                juce::String(ids::trackFieldNames[field]).toUpperCase() + " (T" + juce::String(track) + ")",
                 0,
                 127,
                 0));
@@ -190,13 +208,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParam
 
         // Row 3 (col 1-5): LFO MODE + LFO SPEED/VOL+DIST/SWING/CHANCE
         layout.add(std::make_unique<juce::AudioParameterChoice>(
-            juce::ParameterID { prefix + "lfoMode", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoMode), 1 },
             "LFO Mode (T" + juce::String(track) + ")",
             juce::StringArray { "FREE", "TRG", "HOLD", "ONE", "HALF" },
             0));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "lfoSpeed", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoSpeed), 1 },
             "LFO Speed (T" + juce::String(track) + ")",
             -64,
             63,
@@ -204,54 +222,62 @@ juce::AudioProcessorValueTreeState::ParameterLayout PluginProcessor::createParam
 
         // LFO overlay (track-dependent): MULTIPLY/WAVEFORM/PHASE/DEPTH/DESTINATION/FADE
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "lfoMultiply", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoMultiply), 1 },
             "LFO Multiply (T" + juce::String(track) + ")",
             0,
             23,
             0));
 
         layout.add(std::make_unique<juce::AudioParameterChoice>(
-            juce::ParameterID { prefix + "lfoWaveform", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoWaveform), 1 },
             "LFO Waveform (T" + juce::String(track) + ")",
             juce::StringArray { "TRI", "SIN", "SQR", "SAW", "ENV", "SAW-HLF", "S&H" },
             0));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "lfoPhase", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoPhase), 1 },
             "LFO Phase (T" + juce::String(track) + ")",
             0,
             127,
             0));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "lfoDepth", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoDepth), 1 },
             "LFO Depth (T" + juce::String(track) + ")",
             -64,
             63,
             0));
 
         layout.add(std::make_unique<juce::AudioParameterChoice>(
-            juce::ParameterID { prefix + "lfoDestination", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoDestination), 1 },
             "LFO Destination (T" + juce::String(track) + ")",
             juce::StringArray { " --- ", "PTCH", "FTUN", "DEC", "COLR", "SHPE", "SWEP", "CONT", "DELS", "REVS", "DIST", "PAN", "PAW", "GATE" },
             0));
 
         layout.add(std::make_unique<juce::AudioParameterInt>(
-            juce::ParameterID { prefix + "lfoFade", 1 },
+            juce::ParameterID { ids::trackId(t, ids::lfoFade), 1 },
             "LFO Fade (T" + juce::String(track) + ")",
             -64,
             63,
             0));
 
-        for (auto name : { "volDist", "swing", "chance" })
+        for (auto field : { ids::volDist, ids::swing })
         {
             layout.add(std::make_unique<juce::AudioParameterInt>(
-                juce::ParameterID { prefix + name, 1 },
-                juce::String(name).toUpperCase() + " (T" + juce::String(track) + ")",
+                juce::ParameterID { ids::trackId(t, field), 1 },
+                juce::String(ids::trackFieldNames[field]).toUpperCase() + " (T" + juce::String(track) + ")",
                 0,
                 127,
                 0));
         }
+
+        // Probability that a trig plays, as on the device (127 = always).
+        layout.add(std::make_unique<juce::AudioParameterInt>(
+            juce::ParameterID { ids::trackId(t, ids::chance), 1 },
+            "CHANCE (T" + juce::String(track) + ")",
+            0,
+            127,
+            127));
     }
 
     return layout;
@@ -273,14 +299,24 @@ PluginProcessor::PluginProcessor()
 #endif
 {
     // Cache parameter pointers for the audio/MIDI thread (never call getRawParameterValue in processBlock).
-    for (int track = 1; track <= 6; ++track)
+    trackParams.attach(apvts);
+
+   #if JUCE_DEBUG
+    for (int i = 0; i < ParameterIds::numParameters; ++i)
     {
-        const auto id = juce::String("t") + juce::String(track) + "_pitch";
-        if (auto* p = apvts.getRawParameterValue(id))
-            trackPitchSemitones[(size_t) (track - 1)] = p;
-        else
-            trackPitchSemitones[(size_t) (track - 1)] = &fallbackZero;
+        const auto id = ParameterIds::isTrackIndex(i)
+                          ? ParameterIds::trackId(ParameterIds::trackOfIndex(i), ParameterIds::fieldOfIndex(i))
+                          : ParameterIds::globalId((ParameterIds::GlobalParameter) i);
+        jassert(parameterAt(i) != nullptr && parameterAt(i)->paramID == id);
     }
+   #endif
+
+    ccEngine.attach(*this, apvts);
+    patternChanges.attach(apvts);
+    patternMorph.attach(apvts);
+    incomingCcs.attach(*this, apvts);
+
+    kits.load(KitLibrary::defaultFile());
 }
 
 PluginProcessor::~PluginProcessor() = default;
@@ -290,6 +326,11 @@ const juce::String PluginProcessor::getName() const
     return JucePlugin_Name;
 }
 
+juce::RangedAudioParameter* PluginProcessor::parameterAt (int denseIndex) const
+{
+    return dynamic_cast<juce::RangedAudioParameter*> (getParameters()[denseIndex]);
+}
+
 bool PluginProcessor::acceptsMidi() const
 {
    #if JucePlugin_WantsMidiInput
@@ -322,31 +363,91 @@ double PluginProcessor::getTailLengthSeconds() const
     return 0.0;
 }
 
+// Program 0 is "Init" (default track parameters); programs 1..N are the kits in the library.
 int PluginProcessor::getNumPrograms()
 {
-    return 1;
+    return 1 + kits.size();
 }
 
 int PluginProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram;
 }
 
-void PluginProcessor::setCurrentProgram (int)
+void PluginProcessor::setCurrentProgram (int index)
 {
+    if (index < 0 || index >= getNumPrograms())
+        return;
+
+    currentProgram = index;
+
+    // Kits cover the six tracks only; globals (pattern, FX) keep their current values.
+    StateCodec::Values values {};
+    captureValues(values);
+
+    if (index == 0)
+    {
+        StateCodec::Values defaults {};
+        captureDefaultValues(defaults);
+        std::copy(defaults.begin() + ParameterIds::numGlobals, defaults.end(), values.begin() + ParameterIds::numGlobals);
+    }
+    else
+    {
+        kits.applyTo(index - 1, values);
+    }
+
+    applyValues(values);
+
+    // The device may have drifted from the recalled kit in fields the kit did not change.
+    ccEngine.resendAll();
 }
 
-const juce::String PluginProcessor::getProgramName (int)
+const juce::String PluginProcessor::getProgramName (int index)
 {
-    return {};
+    if (index == 0)
+        return "Init";
+
+    return index > 0 && index <= kits.size() ? kits.getName(index - 1) : juce::String();
 }
 
-void PluginProcessor::changeProgramName (int, const juce::String&)
+void PluginProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    if (index < 1 || index > kits.size())
+        return;
+
+    // rename() reloads the shared file first, so kits another instance saved meanwhile survive.
+    kits.rename(KitLibrary::defaultFile(), index - 1, newName);
+    updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+}
+
+int PluginProcessor::saveTracksAsKit (const juce::String& name)
+{
+    StateCodec::Values values {};
+    captureValues(values);
+
+    if (! kits.add(KitLibrary::defaultFile(), name, values))
+        return -1;
+
+    // The new kit is the last program; the tracks already hold its values.
+    currentProgram = kits.size();
+    updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withProgramChanged(true));
+    return currentProgram;
 }
 
-void PluginProcessor::prepareToPlay (double, int)
+void PluginProcessor::prepareToPlay (double sampleRate, int)
 {
+    dinScheduler.prepare(sampleRate);
+    lfoEngine.prepare(sampleRate);
+    chanceFilter.reset();
+    swingEngine.reset();
+    patternMorph.reset();
+    activeNotes.clear();
+    wasPlaying = false;
+    trackWasUnmuted.fill(true);
+    outputMidi.ensureSize(midiScratchBytes);
+    outputMidi.clear();
+    generatedMidi.ensureSize(midiScratchBytes);
+    generatedMidi.clear();
 }
 
 void PluginProcessor::releaseResources()
@@ -380,42 +481,167 @@ void PluginProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::Midi
 {
     juce::ScopedNoDenormals noDenormals;
 
-    // Pass-through audio.
-    juce::ignoreUnused(buffer);
-
     // Audio FX behaviour: leave audio untouched (pass-through) and transform MIDI.
     // Ableton Live won't load many VST3 "MIDI effect" plugins, but it will pass MIDI through
     // standard audio effects when MIDI I/O is enabled.
 
-    if (! midi.isEmpty())
+    juce::AudioPlayHead::PositionInfo position;
+    if (auto* playHead = getPlayHead())
+        if (const auto hostPosition = playHead->getPosition())
+            position = *hostPosition;
+
+    trackParams.refresh();
+    generatedMidi.clear();
+    const int* const pitchSemitones = trackParams.row(ParameterIds::pitch);
+
+    chanceFilter.beginBlock(trackParams, position.getTimeInSamples(), buffer.getNumSamples());
+    swingEngine.beginBlock(trackParams, position, getSampleRate());
+
+    // Transform in place: the iterator hands out pointers into midi's own storage, so rewriting
+    // the note byte keeps every event at its exact sample position and never allocates.
+    for (const auto metadata : midi)
     {
-        juce::MidiBuffer output;
+        if (metadata.numBytes != 3)
+            continue;
 
-        for (const auto metadata : midi)
+        auto* bytes = const_cast<juce::uint8*> (metadata.data);
+        const int status = bytes[0] & 0xf0;
+
+        // A mapped CC (a knob turned on the device, or a CC lane in the host) updates its parameter
+        // from the message thread. The CC itself still passes through, so the parameter change it
+        // causes is marked as already sent.
+        if (status == 0xb0)
         {
-            auto message = metadata.getMessage();
-            const auto samplePosition = metadata.samplePosition;
+            const int index = ccEngine.findSlot((bytes[0] & 0x0f) + 1, bytes[1]);
+            if (index >= 0)
+            {
+                ccEngine.markReceived(index, bytes[2]);
+                incomingCcs.push(index, bytes[2], ccEngine.encodingOf(index));
+            }
 
-            if (message.isNoteOnOrOff())
+            continue;
+        }
+
+        if (status != 0x80 && status != 0x90)
+            continue;
+
+        // Track mapping: MIDI channels 1-6 -> tracks 1-6.
+        const int channelIdx = bytes[0] & 0x0f;
+        const bool isTrack = channelIdx < TrackParameterSnapshot::numTracks;
+        const bool isNoteOn = status == 0x90 && bytes[2] != 0;
+        const int note = bytes[1];
+
+        if (isNoteOn)
+        {
+            if (isTrack && chanceFilter.shouldDrop(channelIdx, note, metadata.samplePosition))
             {
-                // Track mapping: MIDI channels 1-6 -> tracks 1-6.
-                const int channelIdx = message.getChannel() - 1;
-                const int semis = (channelIdx >= 0 && channelIdx < (int) trackPitchSemitones.size())
-                                    ? (int) std::lround(trackPitchSemitones[(size_t) channelIdx]->load())
-                                    : 0;
-
-                const int note = message.getNoteNumber();
-                const int shifted = juce::jlimit(0, 127, note + semis);
-                message.setNoteNumber(shifted);
+                activeNotes.noteDropped(channelIdx, note);
+                DinOutputScheduler::markDropped(bytes);
+                continue;
             }
 
-            output.addEvent(message, samplePosition);
+            const int sent = isTrack ? juce::jlimit(0, 127, note + pitchSemitones[channelIdx]) : note;
+            activeNotes.noteOn(channelIdx, note, sent);
+            bytes[1] = (juce::uint8) sent;
         }
+        else
+        {
+            // Note-offs go to the key their note-on was sent as, whatever PITCH is now.
+            const int sent = activeNotes.noteOff(channelIdx, note);
+            if (sent == ActiveNoteTable::dropped)
+            {
+                DinOutputScheduler::markDropped(bytes);
+                continue;
+            }
+
+            if (sent != ActiveNoteTable::notHeld)
+                bytes[1] = (juce::uint8) sent;
+            else if (isTrack)
+                bytes[1] = (juce::uint8) juce::jlimit(0, 127, note + pitchSemitones[channelIdx]);
+        }
+
+        if (! isTrack)
+            continue;
+
+        // Swung notes leave this block and come back from the swing queue at their delayed sample,
+        // which is also when they retrigger the track's LFO.
+        if (swingEngine.take(channelIdx, isNoteOn, bytes, metadata.samplePosition))
+            DinOutputScheduler::markDropped(bytes);
+        else if (isNoteOn)
+            lfoEngine.noteOn(channelIdx);
+    }
+
+    // Panic: muting a track or stopping the transport releases every note still held. The
+    // note-offs go on the block's last sample, after every other event of their channel.
+    const bool isPlaying = position.getIsPlaying();
+    const int* const unmuted = trackParams.row(ParameterIds::unmuted);
+    const int lastSample = juce::jmax(0, buffer.getNumSamples() - 1);
+
+    // A track muted in this block also loses the swung notes still waiting to start.
+    for (int t = 0; t < TrackParameterSnapshot::numTracks; ++t)
+        if (unmuted[t] == 0 && trackWasUnmuted[(size_t) t])
+            swingEngine.releaseTrack(t, generatedMidi, lastSample);
+
+    swingEngine.renderDue(generatedMidi, buffer.getNumSamples(), [this] (int track) { lfoEngine.noteOn(track); });
+
+    for (int channel = 0; channel < ActiveNoteTable::numChannels; ++channel)
+    {
+        const bool mutedNow = channel < TrackParameterSnapshot::numTracks
+                              && unmuted[channel] == 0 && trackWasUnmuted[(size_t) channel];
+
+        if ((mutedNow || (wasPlaying && ! isPlaying)) && activeNotes.anyHeld(channel))
+            releaseHeldNotes(channel, generatedMidi, lastSample);
+    }
+
+    wasPlaying = isPlaying;
+    for (size_t t = 0; t < trackWasUnmuted.size(); ++t)
+        trackWasUnmuted[t] = unmuted[t] != 0;
+
+    // Program changes are priority events for the scheduler, so they keep their boundary position.
+    const int previousPattern = patternChanges.getSentProgram();
+    const int patternChangeAt = patternChanges.render(position, getSampleRate(), buffer.getNumSamples(), generatedMidi);
+
+    if (patternChangeAt >= 0)
+    {
+        // Only fails while a state save/restore is copying the store; that change then morphs nothing.
+        const juce::SpinLock::ScopedTryLockType snapshotLock (patternSnapshotLock);
+        if (snapshotLock.isLocked())
+            patternMorph.patternChanged(previousPattern, patternChanges.getSentProgram(), patternChangeAt,
+                                        patternSnapshots, trackParams, position);
+    }
+
+    // Parameter changes join the CC queue; the scheduler interleaves them (and the host's own CCs)
+    // with the notes at a rate the DIN link can carry. A track whose LFO runs here keeps its LFO page
+    // off the device, so the device's own LFO does not modulate the destination a second time.
+    lfoEngine.holdHardwareLfos(trackParams, ccEngine);
+    ccEngine.renderChanges(dinScheduler);
 
-        midi.swapWith(output);
+    // Morph CCs come after the plain changes so a morph in progress wins over the values it replaces.
+    patternMorph.render(trackParams, position, getSampleRate(), buffer.getNumSamples(), dinScheduler, ccEngine, incomingCcs);
+
+    // LFO output is queued after the plain parameter values so it wins for shared destinations.
+    lfoEngine.render(trackParams, patternMorph, position, getSampleRate(), buffer.getNumSamples(), dinScheduler);
+
+    // Events generated above were written to generatedMidi, never into the host's buffer, so the
+    // host buffer is only read until the merged block is copied back into it. Both merge buffers
+    // stay ours at the capacity prepareToPlay gave them; the raw copy reuses the host buffer's own
+    // storage, so a block does not allocate once the host's buffer has held a block this size.
+    if (dinScheduler.process(midi, generatedMidi, outputMidi, buffer.getNumSamples()))
+    {
+        midi.clear();
+        midi.data.addArray(outputMidi.data.getRawDataPointer(), outputMidi.data.size());
     }
 }
 
+void PluginProcessor::releaseHeldNotes (int channel0To15, juce::MidiBuffer& midi, int samplePosition)
+{
+    activeNotes.releaseChannel(channel0To15, [&] (int sentNote)
+    {
+        const juce::uint8 noteOff[3] { (juce::uint8) (0x80 | channel0To15), (juce::uint8) sentNote, 0 };
+        midi.addEvent(noteOff, 3, samplePosition);
+    });
+}
+
 bool PluginProcessor::hasEditor() const
 {
     return true;
@@ -426,16 +652,97 @@ juce::AudioProcessorEditor* PluginProcessor::createEditor()
     return new PluginEditor (*this);
 }
 
+void PluginProcessor::captureValues (StateCodec::Values& values) const
+{
+    for (int i = 0; i < ParameterIds::numParameters; ++i)
+        if (auto* param = parameterAt(i))
+            values[(size_t) i] = (int) std::lround(param->convertFrom0to1(param->getValue()));
+}
+
+void PluginProcessor::captureDefaultValues (StateCodec::Values& values) const
+{
+    for (int i = 0; i < ParameterIds::numParameters; ++i)
+        if (auto* param = parameterAt(i))
+            values[(size_t) i] = (int) std::lround(param->convertFrom0to1(param->getDefaultValue()));
+}
+
+void PluginProcessor::applyValues (const StateCodec::Values& values)
+{
+    // Only parameters whose value actually differs are set, so listeners, attachments and the host
+    // hear about exactly what changed instead of a whole-tree replacement.
+    StateCodec::Values current {};
+    captureValues(current);
+
+    for (int i = 0; i < ParameterIds::numParameters; ++i)
+    {
+        if (values[(size_t) i] == current[(size_t) i])
+            continue;
+
+        if (auto* param = parameterAt(i))
+            param->setValueNotifyingHost(param->convertTo0to1((float) values[(size_t) i]));
+    }
+}
+
+bool PluginProcessor::decodeXmlState (const juce::XmlElement& xml, StateCodec::Values& values) const
+{
+    if (! xml.hasTagName(apvts.state.getType()))
+        return false;
+
+    // APVTS layout: <PARAMS><PARAM id="t1_decay" value="64"/>...</PARAMS>, plain values.
+    // CHANCE did nothing when these sessions were saved (and defaulted to 0, which now means
+    // "never play"), so it keeps its default and the sessions sound as they did.
+    for (auto* child : xml.getChildWithTagNameIterator("PARAM"))
+    {
+        const auto id = child->getStringAttribute("id");
+        const int index = ParameterIds::indexOf(id.toRawUTF8());
+
+        if (index >= 0 && ParameterIds::isTrackIndex(index) && ParameterIds::fieldOfIndex(index) == ParameterIds::chance)
+            continue;
+
+        if (index >= 0 && child->hasAttribute("value"))
+            values[(size_t) index] = (int) std::lround(child->getDoubleAttribute("value"));
+    }
+
+    return true;
+}
+
 void PluginProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    if (auto xml = apvts.copyState().createXml())
-        copyXmlToBinary(*xml, destData);
+    StateCodec::Values values {};
+    captureValues(values);
+
+    {
+        const juce::SpinLock::ScopedLockType lock (patternSnapshotLock);
+        stateSnapshots.copyFrom(patternSnapshots);
+    }
+
+    StateCodec::encode(values, stateSnapshots, destData);
 }
 
 void PluginProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    if (auto xml = getXmlFromBinary(data, sizeInBytes))
-        apvts.replaceState(juce::ValueTree::fromXml(*xml));
+    // Parameters the saved state does not cover (added after it was saved) fall back to defaults.
+    StateCodec::Values values {};
+    captureDefaultValues(values);
+
+    bool decoded = false;
+    stateSnapshots.clear();
+
+    if (StateCodec::isBinaryState(data, sizeInBytes))
+        decoded = StateCodec::decode(data, sizeInBytes, values, stateSnapshots);
+    else if (auto xml = getXmlFromBinary(data, sizeInBytes)) // sessions saved before the binary format
+        decoded = decodeXmlState(*xml, values);
+
+    if (! decoded)
+        return;
+
+    applyValues(values);
+
+    // A restored session may find the device in any state, so it gets every mapped value.
+    ccEngine.resendAll();
+
+    const juce::SpinLock::ScopedLockType lock (patternSnapshotLock);
+    patternSnapshots.copyFrom(stateSnapshots);
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
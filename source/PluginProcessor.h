@@ -2,6 +2,21 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 
+#include "KitLibrary.h"
+#include "ParameterIds.h"
+#include "PatternSnapshotStore.h"
+#include "StateCodec.h"
+#include "TrackParameterSnapshot.h"
+#include "midi_components/ActiveNoteTable.h"
+#include "midi_components/ChanceFilter.h"
+#include "midi_components/DinOutputScheduler.h"
+#include "midi_components/IncomingCcSync.h"
+#include "midi_components/LfoEngine.h"
+#include "midi_components/ParameterCcEngine.h"
+#include "midi_components/PatternChangeEngine.h"
+#include "midi_components/PatternMorphEngine.h"
+#include "midi_components/SwingEngine.h"
+
 class PluginProcessor final : public juce::AudioProcessor
 {
 public:
@@ -11,6 +26,9 @@ public:
     juce::AudioProcessorValueTreeState apvts;
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    // Parameter by ParameterIds dense index (no string lookup). nullptr if out of range.
+    juce::RangedAudioParameter* parameterAt (int denseIndex) const;
+
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
 
@@ -36,12 +54,61 @@ public:
     const juce::String getProgramName (int index) override;
     void changeProgramName (int index, const juce::String& newName) override;
 
+    // Message thread. Stores the six tracks' current parameters as a new kit at the end of the
+    // shared kit file. Returns its program index, or -1 if the file could not be written.
+    int saveTracksAsKit (const juce::String& name);
+
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    // Outgoing CC pacing counters (sent / coalesced / dropped). Safe to read from any thread.
+    const DinOutputScheduler::Stats& getMidiOutputStats() const noexcept { return dinScheduler.getStats(); }
+
+    // Swing queue overflow counter. Safe to read from any thread.
+    const SwingEngine::Stats& getSwingStats() const noexcept { return swingEngine.getStats(); }
+
 private:
-    std::atomic<float> fallbackZero { 0.0f };
-    std::array<std::atomic<float>*, 6> trackPitchSemitones { { &fallbackZero, &fallbackZero, &fallbackZero, &fallbackZero, &fallbackZero, &fallbackZero } };
+    // Per-track parameter values, refreshed at the top of every processBlock.
+    TrackParameterSnapshot trackParams;
+
+    ParameterCcEngine ccEngine;
+    IncomingCcSync incomingCcs;
+    DinOutputScheduler dinScheduler;
+    PatternChangeEngine patternChanges;
+    PatternMorphEngine patternMorph;
+    LfoEngine lfoEngine;
+    ChanceFilter chanceFilter;
+    SwingEngine swingEngine;
+
+    // Held notes per channel (audio thread only), plus the state that triggers a panic.
+    ActiveNoteTable activeNotes;
+    bool wasPlaying { false };
+    std::array<bool, TrackParameterSnapshot::numTracks> trackWasUnmuted { { true, true, true, true, true, true } };
+
+    void releaseHeldNotes (int channel0To15, juce::MidiBuffer& midi, int samplePosition);
+
+    // Track parameters per pattern slot, captured when a pattern is left. The audio thread only
+    // touches it under a try-lock that state save/restore holds while copying it in or out.
+    PatternSnapshotStore patternSnapshots;
+    juce::SpinLock patternSnapshotLock;
+    PatternSnapshotStore stateSnapshots; // message thread: the copy being saved or restored
+
+    // Kits exposed as programs 1..N (loaded at construction, reloaded when a kit is saved or renamed).
+    KitLibrary kits;
+    int currentProgram { 0 };
+
+    // Plain values of every parameter in dense-index order (state save/restore).
+    void captureValues (StateCodec::Values& values) const;
+    void captureDefaultValues (StateCodec::Values& values) const;
+    void applyValues (const StateCodec::Values& values);
+    bool decodeXmlState (const juce::XmlElement& xml, StateCodec::Values& values) const;
+
+    // Scratch buffers (sized in prepareToPlay, never handed to the host): events the processor
+    // generates in a block (swing output, panic note-offs, program changes), and the merged block
+    // that is copied back into the host buffer.
+    static constexpr size_t midiScratchBytes = 16384;
+    juce::MidiBuffer generatedMidi;
+    juce::MidiBuffer outputMidi;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginProcessor)
 };
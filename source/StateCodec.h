@@ -0,0 +1,211 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <array>
+#include <cstring>
+
+#include "ParameterIds.h"
+#include "PatternSnapshotStore.h"
+
+// Compact binary plug-in state.
+//
+//   "MCYS"  magic
+//   varint  format version
+//   varint  global count, track count, per-track field count (as written)
+//   varint  zigzag(plain value) per global, then per track per field, in ParameterIds order
+//   varint  stored pattern snapshot count                                        (version 2+)
+//           per snapshot: varint slot, then zigzag(value) per track per field
+//
+// Before version 3, t{N}_chance held the probability that a trig is dropped; decode() turns it
+// into the probability that it plays (127 - value), in the parameters and the snapshots alike.
+//
+// Every parameter is integer-valued (int, bool or choice index), so a typical value is one byte
+// and a whole state is a few hundred bytes plus about 160 bytes per stored pattern snapshot.
+// Because the counts are stored, a state written before parameters were appended to either
+// ParameterIds list still loads; the new parameters keep the values they had before decode(), and
+// snapshot fields that were not saved take the restored parameter's value.
+namespace StateCodec
+{
+    using Values = std::array<int, ParameterIds::numParameters>;
+
+    constexpr char magic[4] { 'M', 'C', 'Y', 'S' };
+    constexpr int formatVersion = 3;
+
+    // Worst case: header + a 5-byte varint per value, then every snapshot slot stored (snapshot
+    // values are int8, so at most 2 bytes each).
+    constexpr size_t maxEncodedSize = sizeof(magic) + 4 * 5 + (size_t) ParameterIds::numParameters * 5
+                                    + 5 + (size_t) PatternSnapshotStore::numSlots * (5 + (size_t) PatternSnapshotStore::valuesPerSlot * 2);
+
+    inline bool isBinaryState(const void* data, int sizeInBytes)
+    {
+        return data != nullptr && sizeInBytes >= (int) sizeof(magic) && std::memcmp(data, magic, sizeof(magic)) == 0;
+    }
+
+    namespace detail
+    {
+        inline juce::uint8* writeVarint(juce::uint8* out, juce::uint32 v) noexcept
+        {
+            while (v >= 0x80)
+            {
+                *out++ = (juce::uint8) (v | 0x80);
+                v >>= 7;
+            }
+
+            *out++ = (juce::uint8) v;
+            return out;
+        }
+
+        inline bool readVarint(const juce::uint8*& in, const juce::uint8* end, juce::uint32& v) noexcept
+        {
+            v = 0;
+            for (int shift = 0; shift < 35 && in < end; shift += 7)
+            {
+                const auto byte = *in++;
+                v |= (juce::uint32) (byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        constexpr juce::uint32 zigzag(int v) noexcept { return ((juce::uint32) v << 1) ^ (juce::uint32) (v >> 31); }
+        constexpr int unzigzag(juce::uint32 v) noexcept { return (int) (v >> 1) ^ -(int) (v & 1); }
+    }
+
+    inline void encode(const Values& values, const PatternSnapshotStore& snapshots, juce::MemoryBlock& dest)
+    {
+        dest.setSize(maxEncodedSize, false);
+
+        auto* const start = static_cast<juce::uint8*>(dest.getData());
+        std::memcpy(start, magic, sizeof(magic));
+
+        auto* out = start + sizeof(magic);
+        out = detail::writeVarint(out, (juce::uint32) formatVersion);
+        out = detail::writeVarint(out, (juce::uint32) ParameterIds::numGlobals);
+        out = detail::writeVarint(out, (juce::uint32) ParameterIds::numTracks);
+        out = detail::writeVarint(out, (juce::uint32) ParameterIds::numTrackFields);
+
+        for (const int v : values)
+            out = detail::writeVarint(out, detail::zigzag(v));
+
+        juce::uint32 numStored = 0;
+        for (int slot = 0; slot < PatternSnapshotStore::numSlots; ++slot)
+            numStored += snapshots.has(slot) ? 1u : 0u;
+
+        out = detail::writeVarint(out, numStored);
+
+        for (int slot = 0; slot < PatternSnapshotStore::numSlots; ++slot)
+        {
+            if (! snapshots.has(slot))
+                continue;
+
+            out = detail::writeVarint(out, (juce::uint32) slot);
+
+            const auto* src = snapshots.slotData(slot);
+            for (int i = 0; i < PatternSnapshotStore::valuesPerSlot; ++i)
+                out = detail::writeVarint(out, detail::zigzag(src[i]));
+        }
+
+        dest.setSize((size_t) (out - start), false);
+    }
+
+    // Overwrites the entries of `values` present in the blob and replaces `snapshots` with the
+    // blob's (none for a version 1 state). Returns false if it is not a state this version can
+    // read (in which case `values` and `snapshots` may be partially updated).
+    inline bool decode(const void* data, int sizeInBytes, Values& values, PatternSnapshotStore& snapshots)
+    {
+        if (! isBinaryState(data, sizeInBytes))
+            return false;
+
+        const auto* in = static_cast<const juce::uint8*>(data) + sizeof(magic);
+        const auto* const end = static_cast<const juce::uint8*>(data) + sizeInBytes;
+
+        juce::uint32 version = 0, globals = 0, tracks = 0, fields = 0;
+        if (! detail::readVarint(in, end, version) || version == 0 || version > (juce::uint32) formatVersion
+            || ! detail::readVarint(in, end, globals)
+            || ! detail::readVarint(in, end, tracks)
+            || ! detail::readVarint(in, end, fields))
+            return false;
+
+        auto next = [&] (int& value)
+        {
+            juce::uint32 v = 0;
+            if (! detail::readVarint(in, end, v))
+                return false;
+
+            value = detail::unzigzag(v);
+            return true;
+        };
+
+        int discard = 0;
+
+        auto isDropChance = [version] (juce::uint32 f)
+        {
+            return version < 3 && f == (juce::uint32) ParameterIds::chance;
+        };
+
+        for (juce::uint32 g = 0; g < globals; ++g)
+            if (! next(g < (juce::uint32) ParameterIds::numGlobals ? values[(size_t) g] : discard))
+                return false;
+
+        for (juce::uint32 t = 0; t < tracks; ++t)
+            for (juce::uint32 f = 0; f < fields; ++f)
+            {
+                const bool known = t < (juce::uint32) ParameterIds::numTracks && f < (juce::uint32) ParameterIds::numTrackFields;
+                auto& target = known ? values[(size_t) ParameterIds::index((int) t, (ParameterIds::TrackField) f)] : discard;
+
+                if (! next(target))
+                    return false;
+
+                if (isDropChance(f))
+                    target = 127 - juce::jlimit(0, 127, target);
+            }
+
+        snapshots.clear();
+
+        if (version < 2)
+            return true;
+
+        juce::uint32 numStored = 0;
+        if (! detail::readVarint(in, end, numStored))
+            return false;
+
+        for (juce::uint32 n = 0; n < numStored; ++n)
+        {
+            juce::uint32 slot = 0;
+            if (! detail::readVarint(in, end, slot))
+                return false;
+
+            const bool validSlot = PatternSnapshotStore::isValidSlot((int) juce::jmin(slot, 0x7fffffffu));
+            juce::int8 unused[PatternSnapshotStore::valuesPerSlot] {};
+            auto* dest = validSlot ? snapshots.slotData((int) slot) : unused;
+
+            // Fields this blob has no value for follow the restored parameters.
+            for (int t = 0; t < ParameterIds::numTracks; ++t)
+                for (int f = 0; f < ParameterIds::numTrackFields; ++f)
+                    dest[t * ParameterIds::numTrackFields + f]
+                        = (juce::int8) juce::jlimit(-128, 127, values[(size_t) ParameterIds::index(t, (ParameterIds::TrackField) f)]);
+
+            for (juce::uint32 t = 0; t < tracks; ++t)
+                for (juce::uint32 f = 0; f < fields; ++f)
+                {
+                    int value = 0;
+                    if (! next(value))
+                        return false;
+
+                    if (isDropChance(f))
+                        value = 127 - juce::jlimit(0, 127, value);
+
+                    if (t < (juce::uint32) ParameterIds::numTracks && f < (juce::uint32) ParameterIds::numTrackFields)
+                        dest[t * (juce::uint32) ParameterIds::numTrackFields + f] = (juce::int8) juce::jlimit(-128, 127, value);
+                }
+
+            if (validSlot)
+                snapshots.markStored((int) slot);
+        }
+
+        return true;
+    }
+}
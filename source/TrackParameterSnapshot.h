@@ -0,0 +1,70 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "ParameterIds.h"
+
+// Per-track parameter values for the audio thread, stored structure-of-arrays: one cache-line
+// aligned row per field, one int per track. refresh() copies every atomic once at the top of the
+// block, so per-event code reads plain contiguous ints instead of chasing six scattered pointers.
+class TrackParameterSnapshot final
+{
+public:
+    static constexpr int numTracks = ParameterIds::numTracks;
+
+    // Rows are padded to 8 tracks (32 bytes) so two fields share a cache line and never straddle one.
+    static constexpr int trackStride = 8;
+
+    using Field = ParameterIds::TrackField;
+    static constexpr int numFields = ParameterIds::numTrackFields;
+
+    TrackParameterSnapshot() = default;
+
+    // Message thread, before processing starts. Missing parameters read as 0.
+    void attach(juce::AudioProcessorValueTreeState& apvts)
+    {
+        for (int f = 0; f < numFields; ++f)
+        {
+            sources[(size_t) f].fill(&fallbackZero);
+
+            for (int track = 0; track < numTracks; ++track)
+                if (auto* p = apvts.getRawParameterValue(ParameterIds::trackId(track, (Field) f)))
+                    sources[(size_t) f][(size_t) track] = p;
+        }
+
+        refresh();
+    }
+
+    // Audio thread, once per block.
+    void refresh() noexcept
+    {
+        for (size_t f = 0; f < (size_t) numFields; ++f)
+            for (size_t track = 0; track < (size_t) numTracks; ++track)
+                values[f][track] = (int) std::lround(sources[f][track]->load(std::memory_order_relaxed));
+    }
+
+    int get(Field field, int trackIndex0To5) const noexcept
+    {
+        return values[(size_t) field][(size_t) trackIndex0To5];
+    }
+
+    // All tracks of one field, indexed 0..5.
+    const int* row(Field field) const noexcept
+    {
+        return values[(size_t) field].data();
+    }
+
+private:
+    using Row = std::array<int, trackStride>;
+
+    alignas(64) std::array<Row, numFields> values {};
+
+    std::array<std::array<std::atomic<float>*, trackStride>, numFields> sources {};
+    std::atomic<float> fallbackZero { 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackParameterSnapshot)
+};
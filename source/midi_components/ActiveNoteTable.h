@@ -0,0 +1,105 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+
+// Which notes are currently held on the device, per MIDI channel, and which key each one was sent
+// as. A note-off is matched to its note-on through this table in O(1), so it goes to the key that
+// was actually sent even if PITCH moved while the note was held, and a note-on that was filtered
+// out takes its note-off with it. The same table drives instant all-notes-off per channel.
+class ActiveNoteTable final
+{
+public:
+    static constexpr int numChannels = 16;
+
+    // noteOff() results besides a key number.
+    static constexpr int notHeld = -1;
+    static constexpr int dropped = -2;
+
+    ActiveNoteTable()
+    {
+        clear();
+    }
+
+    void clear() noexcept
+    {
+        held.fill(0);
+        sentNote.fill(0);
+    }
+
+    void noteOn(int channel0To15, int note, int sent) noexcept
+    {
+        set(channel0To15, note, (juce::uint8) sent);
+    }
+
+    // The note-on never went out; its note-off must not either.
+    void noteDropped(int channel0To15, int note) noexcept
+    {
+        set(channel0To15, note, droppedMarker);
+    }
+
+    // Returns the key the matching note-on was sent as, `dropped`, or `notHeld`.
+    int noteOff(int channel0To15, int note) noexcept
+    {
+        const auto i = index(channel0To15, note);
+        auto& word = held[i >> 6];
+        const auto bit = (juce::uint64) 1 << (i & 63);
+
+        if ((word & bit) == 0)
+            return notHeld;
+
+        word &= ~bit;
+        return sentNote[i] == droppedMarker ? dropped : (int) sentNote[i];
+    }
+
+    bool anyHeld(int channel0To15) const noexcept
+    {
+        const auto w = (size_t) channel0To15 * 2;
+        return (held[w] | held[w + 1]) != 0;
+    }
+
+    // Calls sendNoteOff(sentKey) for every note still sounding on the channel and forgets them.
+    template <typename Fn>
+    void releaseChannel(int channel0To15, Fn&& sendNoteOff)
+    {
+        for (size_t w = (size_t) channel0To15 * 2; w < (size_t) channel0To15 * 2 + 2; ++w)
+        {
+            auto bits = held[w];
+            held[w] = 0;
+
+            while (bits != 0)
+            {
+                const auto lowest = bits & (~bits + 1);
+                bits ^= lowest;
+
+                const auto i = w * 64 + (size_t) juce::countNumberOfBits(lowest - 1);
+                if (sentNote[i] != droppedMarker)
+                    sendNoteOff((int) sentNote[i]);
+            }
+        }
+    }
+
+private:
+    static constexpr juce::uint8 droppedMarker = 0xff;
+
+    static size_t index(int channel0To15, int note) noexcept
+    {
+        return (size_t) ((channel0To15 & 0x0f) * 128 + (note & 0x7f));
+    }
+
+    void set(int channel0To15, int note, juce::uint8 sent) noexcept
+    {
+        const auto i = index(channel0To15, note);
+        held[i >> 6] |= (juce::uint64) 1 << (i & 63);
+        sentNote[i] = sent;
+    }
+
+    // One bit per (channel, incoming key) with a note-on outstanding.
+    std::array<juce::uint64, numChannels * 2> held {};
+
+    // Key each held note was sent as (droppedMarker: filtered out).
+    std::array<juce::uint8, numChannels * 128> sentNote {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ActiveNoteTable)
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+
+#include "../ParameterIds.h"
+#include "../TrackParameterSnapshot.h"
+
+// Thins note-ons per track by t{N}_chance, which is the probability that a trig plays, as on the
+// device: each note-on is dropped with probability (127 - chance) / 127 (127, the default, plays
+// every note). The caller drops the matching note-off through the ActiveNoteTable.
+// The decision is a hash of (track, note, absolute sample position) rather than a running PRNG,
+// so it is lock- and allocation-free, independent of block size, and an offline bounce that
+// starts at the same song position makes the same decisions every time.
+class ChanceFilter final
+{
+public:
+    static constexpr int numTracks = TrackParameterSnapshot::numTracks;
+
+    ChanceFilter() = default;
+
+    void reset() noexcept
+    {
+        nextBlockStart = 0;
+    }
+
+    // Audio thread, once per block. songPositionSamples is the host's timeInSamples when it has
+    // one; otherwise the filter keeps its own running position.
+    void beginBlock(const TrackParameterSnapshot& params, const juce::Optional<juce::int64>& songPositionSamples,
+                    int numSamples) noexcept
+    {
+        blockStart = songPositionSamples.orFallback(nextBlockStart);
+        nextBlockStart = blockStart + numSamples;
+
+        const int* const chance = params.row(ParameterIds::chance);
+        for (size_t t = 0; t < (size_t) numTracks; ++t)
+            threshold[t] = (juce::uint32) (127 - juce::jlimit(0, 127, chance[t])) * (0x1000000u / 127u + 1u);
+    }
+
+    // Audio thread, for note-ons on a track channel.
+    bool shouldDrop(int trackIndex0To5, int note, int samplePosition) const noexcept
+    {
+        const auto h = hash((juce::uint64) (blockStart + samplePosition), trackIndex0To5, note);
+        return (juce::uint32) (h & 0xffffff) < threshold[(size_t) trackIndex0To5];
+    }
+
+private:
+    // splitmix64 finalizer over the event coordinates.
+    static juce::uint64 hash(juce::uint64 samplePosition, int track, int note) noexcept
+    {
+        auto x = samplePosition * 0x9e3779b97f4a7c15ull ^ ((juce::uint64) track << 56) ^ ((juce::uint64) note << 48);
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    // Drop when the low 24 hash bits fall under (127 - chance) * 2^24 / 127 (chance 0 always drops).
+    std::array<juce::uint32, numTracks> threshold {};
+
+    juce::int64 blockStart { 0 };
+    juce::int64 nextBlockStart { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChanceFilter)
+};
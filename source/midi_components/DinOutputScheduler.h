@@ -0,0 +1,266 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+
+// Paces outgoing MIDI to what a 5-pin DIN link can actually carry.
+// The link runs at 31250 baud with 10 bits per byte (3125 bytes/s, ~1000 three-byte messages per
+// second). Notes, clock and program changes keep their exact sample positions; CCs are held in a
+// coalescing table (one pending value per channel/controller, latest wins) and only placed in idle
+// gaps where they cannot push a later note back. Whatever does not fit is carried into the next
+// block, so a burst of dial moves costs latency on the CCs instead of smearing the notes.
+//
+// A CC is never sent before the sample it was queued for, so a host CC cannot overtake the notes
+// and program changes that came before it. Bank select (CC 0/32) and channel mode messages
+// (CC 120-127) are sequencing, not sound parameters: they pass through in order at their own
+// position, like notes, and are never paced or coalesced.
+class DinOutputScheduler final
+{
+public:
+    static constexpr double linkBytesPerSecond = 31250.0 / 10.0;
+
+    // Distinct controllers that may be waiting at once (~0.5 s of link time). Beyond that new
+    // controllers are dropped rather than growing latency without bound.
+    static constexpr int maxPendingCcs = 512;
+
+    // Status byte (undefined in MIDI 1.0) that in-place filters write over an event to remove it
+    // from the block without rebuilding the host buffer; process() leaves such events out.
+    static constexpr juce::uint8 droppedStatus = 0xfd;
+
+    static void markDropped(juce::uint8* eventBytes) noexcept
+    {
+        eventBytes[0] = droppedStatus;
+    }
+
+    struct Stats
+    {
+        std::atomic<juce::uint64> ccsSent { 0 };
+        std::atomic<juce::uint64> ccsCoalesced { 0 };
+        std::atomic<juce::uint64> ccsDropped { 0 };
+        std::atomic<int> ccsPending { 0 };
+    };
+
+    DinOutputScheduler()
+    {
+        reset();
+    }
+
+    // Before processing starts.
+    void prepare(double sampleRate)
+    {
+        samplesPerByte = sampleRate / linkBytesPerSecond;
+        reset();
+    }
+
+    void reset()
+    {
+        pendingValue.fill(-1);
+        pendingNotBefore.fill(0);
+        fifoHead = 0;
+        fifoSize = 0;
+        linkFreeAt = 0.0;
+        stats.ccsPending.store(0, std::memory_order_relaxed);
+    }
+
+    // Audio thread. Queues a CC that may go out from sample `notBefore` of the current block on; a
+    // value still waiting for the same channel/controller is replaced (and waits for the later of
+    // the two positions).
+    void queueControlChange(int channel1To16, int cc, int value, int notBefore = 0)
+    {
+        const int key = ((channel1To16 - 1) & 0x0f) * 128 + (cc & 0x7f);
+        auto& slot = pendingValue[(size_t) key];
+
+        if (slot >= 0)
+        {
+            slot = (juce::int8) (value & 0x7f);
+            pendingNotBefore[(size_t) key] = juce::jmax(pendingNotBefore[(size_t) key], notBefore);
+            ++coalescedThisBlock;
+            return;
+        }
+
+        if (fifoSize == maxPendingCcs)
+        {
+            ++droppedThisBlock;
+            return;
+        }
+
+        slot = (juce::int8) (value & 0x7f);
+        pendingNotBefore[(size_t) key] = notBefore;
+        fifo[(size_t) ((fifoHead + fifoSize) % maxPendingCcs)] = (juce::uint16) key;
+        ++fifoSize;
+    }
+
+    // Audio thread. Merges the host's block `in` with the events the plug-in generated for this
+    // block (`generated`: swing output, panic note-offs, program changes; at equal positions the
+    // host's events go first). Paced CCs join the coalescing queue at their own position, events
+    // marked dropped are removed, and every other event is sent at its own sample position. Writes
+    // the paced block to `out` and returns true, or returns false when there is nothing to
+    // interleave and `in` can go out unchanged.
+    bool process(const juce::MidiBuffer& in, const juce::MidiBuffer& generated, juce::MidiBuffer& out, int numSamples)
+    {
+        bool mustRebuild = fifoSize > 0 || ! generated.isEmpty();
+        for (const auto metadata : in)
+        {
+            if (mustRebuild)
+                break;
+
+            mustRebuild = isPacedControlChange(metadata) || metadata.data[0] == droppedStatus;
+        }
+
+        double cursor = juce::jmax(0.0, linkFreeAt);
+        int sent = 0;
+
+        if (! mustRebuild)
+        {
+            // Fast path: nothing to interleave, just account for the link time the events use.
+            for (const auto metadata : in)
+                cursor = juce::jmax(cursor, (double) metadata.samplePosition) + cost(metadata.numBytes);
+
+            finishBlock(cursor, numSamples, sent);
+            return false;
+        }
+
+        out.clear();
+        const double ccCost = cost(3);
+
+        auto nextIn = in.cbegin();
+        auto nextGenerated = generated.cbegin();
+
+        while (nextIn != in.cend() || nextGenerated != generated.cend())
+        {
+            const bool fromIn = nextGenerated == generated.cend()
+                                || (nextIn != in.cend() && (*nextIn).samplePosition <= (*nextGenerated).samplePosition);
+            const auto metadata = fromIn ? *nextIn : *nextGenerated;
+
+            if (fromIn)
+                ++nextIn;
+            else
+                ++nextGenerated;
+
+            if (metadata.data[0] == droppedStatus)
+                continue;
+
+            if (isPacedControlChange(metadata))
+            {
+                queueControlChange((metadata.data[0] & 0x0f) + 1, metadata.data[1], metadata.data[2],
+                                   metadata.samplePosition);
+                continue;
+            }
+
+            // Fill the idle time before this event with the CCs queued ahead of it that finish
+            // before it starts. A CC the host put at this very sample, ahead of the event, keeps
+            // its place if the link is free by then.
+            const int position = metadata.samplePosition;
+            while (fifoSize > 0)
+            {
+                const int notBefore = pendingNotBefore[(size_t) fifo[(size_t) fifoHead]];
+                const double start = juce::jmax(cursor, (double) notBefore);
+
+                if (start + ccCost > (double) position && ! (notBefore == position && start <= (double) position))
+                    break;
+
+                emitNextCc(out, (int) start);
+                cursor = start + ccCost;
+                ++sent;
+            }
+
+            out.addEvent(metadata.data, metadata.numBytes, position);
+            cursor = juce::jmax(cursor, (double) position) + cost(metadata.numBytes);
+        }
+
+        while (fifoSize > 0)
+        {
+            const double start = juce::jmax(cursor, (double) pendingNotBefore[(size_t) fifo[(size_t) fifoHead]]);
+            if (start >= (double) numSamples)
+                break;
+
+            emitNextCc(out, (int) start);
+            cursor = start + ccCost;
+            ++sent;
+        }
+
+        finishBlock(cursor, numSamples, sent);
+        return true;
+    }
+
+    // Any thread.
+    const Stats& getStats() const noexcept { return stats; }
+
+private:
+    // Sound-parameter CCs; bank select and channel mode messages are excluded (see above).
+    static bool isPacedControlChange(const juce::MidiMessageMetadata& m) noexcept
+    {
+        if (m.numBytes != 3 || (m.data[0] & 0xf0) != 0xb0)
+            return false;
+
+        const int cc = m.data[1];
+        return cc != 0 && cc != 32 && cc < 120;
+    }
+
+    double cost(int numBytes) const noexcept
+    {
+        return (double) numBytes * samplesPerByte;
+    }
+
+    void emitNextCc(juce::MidiBuffer& out, int samplePosition)
+    {
+        const int key = fifo[(size_t) fifoHead];
+        fifoHead = (fifoHead + 1) % maxPendingCcs;
+        --fifoSize;
+
+        auto& slot = pendingValue[(size_t) key];
+        const juce::uint8 message[3] { (juce::uint8) (0xb0 | (key >> 7)), (juce::uint8) (key & 0x7f), (juce::uint8) slot };
+        slot = -1;
+
+        out.addEvent(message, 3, samplePosition);
+    }
+
+    void finishBlock(double cursor, int numSamples, int sent)
+    {
+        // Carry link occupancy and the waiting CCs' positions into the next block (block-relative,
+        // so they stay small).
+        linkFreeAt = cursor - (double) numSamples;
+
+        for (int i = 0; i < fifoSize; ++i)
+        {
+            auto& notBefore = pendingNotBefore[(size_t) fifo[(size_t) ((fifoHead + i) % maxPendingCcs)]];
+            notBefore = juce::jmax(0, notBefore - numSamples);
+        }
+
+        if (sent > 0)
+            stats.ccsSent.fetch_add((juce::uint64) sent, std::memory_order_relaxed);
+        if (coalescedThisBlock > 0)
+            stats.ccsCoalesced.fetch_add((juce::uint64) coalescedThisBlock, std::memory_order_relaxed);
+        if (droppedThisBlock > 0)
+            stats.ccsDropped.fetch_add((juce::uint64) droppedThisBlock, std::memory_order_relaxed);
+
+        stats.ccsPending.store(fifoSize, std::memory_order_relaxed);
+        coalescedThisBlock = 0;
+        droppedThisBlock = 0;
+    }
+
+    double samplesPerByte { 44100.0 / linkBytesPerSecond };
+
+    // Time (samples, relative to the start of the next block) at which the link goes idle.
+    double linkFreeAt { 0.0 };
+
+    // Pending value per (channel * 128 + controller), -1 when nothing is waiting.
+    std::array<juce::int8, 16 * 128> pendingValue {};
+
+    // First sample (relative to the current block) each pending value may be sent at.
+    std::array<int, 16 * 128> pendingNotBefore {};
+
+    // Keys in the order they were first queued, so no controller starves behind a busy one.
+    std::array<juce::uint16, maxPendingCcs> fifo {};
+    int fifoHead { 0 };
+    int fifoSize { 0 };
+
+    int coalescedThisBlock { 0 };
+    int droppedThisBlock { 0 };
+
+    Stats stats;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DinOutputScheduler)
+};
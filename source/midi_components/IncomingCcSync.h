@@ -0,0 +1,187 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+
+#include "../ParameterIds.h"
+#include "ModelCyclesMidiMap.h"
+
+// Applies CCs received from the Model:Cycles (knob turns on the device) to the matching parameters.
+// The audio thread only pushes compact (parameter index, CC value) records into a wait-free
+// single-producer/single-consumer FIFO. A message-thread timer drains it in batches, keeps only
+// the newest value per parameter, and calls setValueNotifyingHost, so a 1 kHz knob stream costs
+// the UI one update per parameter per tick. The timer only runs while CCs arrive: the first push
+// after a quiet tick starts it (via handleAsyncUpdate() on the message thread), and a tick that
+// finds nothing new stops it.
+class IncomingCcSync final : private juce::Timer,
+                             private juce::AsyncUpdater
+{
+public:
+    static constexpr int fifoCapacity = 2048;
+    static constexpr int drainRateHz = 60;
+
+    IncomingCcSync() = default;
+
+    ~IncomingCcSync() override
+    {
+        cancelPendingUpdate();
+        stopTimer();
+    }
+
+    // Message thread. Resolves every parameter once; the drain then never looks one up.
+    void attach(juce::AudioProcessor& processorToUse, juce::AudioProcessorValueTreeState& apvts)
+    {
+        const auto& all = processorToUse.getParameters();
+        for (int i = 0; i < ParameterIds::numParameters; ++i)
+            parameters[(size_t) i] = i < all.size() ? dynamic_cast<juce::RangedAudioParameter*>(all[i]) : nullptr;
+
+        delaySyncEnabled = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::delayTimeSyncEnabled));
+        delaySyncIndex = parameters[(size_t) ParameterIds::index(ParameterIds::delayTimeSyncIndexGlobal)];
+        latest.fill(-1);
+    }
+
+    // Audio thread. Returns false (and the value is lost) only if the message thread has fallen
+    // more than fifoCapacity records behind.
+    bool push(int parameterIndex, int ccValue, ModelCyclesMidi::CcEncoding encoding) noexcept
+    {
+        {
+            const auto scope = fifo.write(1);
+            if (scope.blockSize1 + scope.blockSize2 == 0)
+                return false;
+
+            auto& r = records[(size_t) (scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)];
+            r.index = (juce::int16) parameterIndex;
+            r.value = (juce::uint8) ccValue;
+            r.encoding = encoding;
+        }
+
+        // Only the push that follows a quiet tick needs to wake the timer (the record is published
+        // by now, so the tick that follows will see it).
+        if (! pushedSinceTick.exchange(true, std::memory_order_acq_rel))
+            triggerAsyncUpdate();
+
+        return true;
+    }
+
+private:
+    struct Record
+    {
+        juce::int16 index;
+        juce::uint8 value;
+        ModelCyclesMidi::CcEncoding encoding;
+    };
+
+    void handleAsyncUpdate() override
+    {
+        if (! isTimerRunning())
+            startTimerHz(drainRateHz);
+    }
+
+    void timerCallback() override
+    {
+        // Nothing arrived since the last tick: idle until the next push.
+        if (! pushedSinceTick.exchange(false, std::memory_order_acq_rel))
+        {
+            stopTimer();
+            return;
+        }
+
+        int numTouched = 0;
+
+        // Coalesce the batch: only the newest value per parameter is applied.
+        {
+            const auto scope = fifo.read(fifo.getNumReady());
+
+            auto take = [&] (int start, int size)
+            {
+                for (int i = start; i < start + size; ++i)
+                {
+                    const auto& r = records[(size_t) i];
+                    if (latest[(size_t) r.index] < 0)
+                        touched[(size_t) numTouched++] = r.index;
+
+                    latest[(size_t) r.index] = r.value;
+                    encodings[(size_t) r.index] = r.encoding;
+                }
+            };
+
+            take(scope.startIndex1, scope.blockSize1);
+            take(scope.startIndex2, scope.blockSize2);
+        }
+
+        for (int i = 0; i < numTouched; ++i)
+        {
+            const int index = touched[(size_t) i];
+            apply(index, latest[(size_t) index], encodings[(size_t) index]);
+            latest[(size_t) index] = -1;
+        }
+    }
+
+    void apply(int index, int ccValue, ModelCyclesMidi::CcEncoding encoding)
+    {
+        using ModelCyclesMidi::CcEncoding;
+
+        auto* param = parameters[(size_t) index];
+        if (param == nullptr)
+            return;
+
+        float plain = 0.0f;
+
+        switch (encoding)
+        {
+            case CcEncoding::Bool:
+                plain = ccValue >= 64 ? 1.0f : 0.0f;
+                break;
+
+            case CcEncoding::InvertedBool:
+                plain = ccValue >= 64 ? 0.0f : 1.0f;
+                break;
+
+            case CcEncoding::DelayTime:
+                if (applyDelaySyncStep(ccValue))
+                    return;
+
+                plain = (float) ccValue;
+                break;
+
+            case CcEncoding::Offset:
+                plain = (float) ccValue + param->getNormalisableRange().start;
+                break;
+        }
+
+        const float normalised = param->convertTo0to1(plain);
+        if (param->getValue() != normalised)
+            param->setValueNotifyingHost(normalised);
+    }
+
+    // With delay sync on, the device's DELAY TIME lands on the nearest sync step instead.
+    bool applyDelaySyncStep(int ccValue)
+    {
+        if (delaySyncEnabled == nullptr || delaySyncIndex == nullptr || delaySyncEnabled->load() < 0.5f)
+            return false;
+
+        const int best = ModelCyclesMidi::nearestDelaySyncStep(ccValue);
+        delaySyncIndex->setValueNotifyingHost(delaySyncIndex->convertTo0to1((float) best));
+        return true;
+    }
+
+    // Fixed after attach(): every parameter by dense index (nullptr until attached).
+    std::array<juce::RangedAudioParameter*, ParameterIds::numParameters> parameters {};
+    std::atomic<float>* delaySyncEnabled { nullptr };
+    juce::RangedAudioParameter* delaySyncIndex { nullptr };
+
+    // Set by push(), cleared by the tick that drains it.
+    std::atomic<bool> pushedSinceTick { false };
+
+    juce::AbstractFifo fifo { fifoCapacity };
+    std::array<Record, fifoCapacity> records {};
+
+    // Message thread only: newest value per parameter in the current batch (-1 = none).
+    std::array<int, ParameterIds::numParameters> latest {};
+    std::array<ModelCyclesMidi::CcEncoding, ParameterIds::numParameters> encodings {};
+    std::array<int, ParameterIds::numParameters> touched {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IncomingCcSync)
+};
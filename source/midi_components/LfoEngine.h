@@ -0,0 +1,345 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <cmath>
+
+#include "../ParameterIds.h"
+#include "../TrackParameterSnapshot.h"
+#include "DinOutputScheduler.h"
+#include "ModelCyclesMidiMap.h"
+#include "ParameterCcEngine.h"
+#include "PatternMorphEngine.h"
+
+// Software LFOs mirroring the per-track LFO page (mode, speed, multiplier, waveform, phase, depth,
+// destination, fade). All six tracks are evaluated once per block from the parameter snapshot in
+// lane-parallel passes over fixed arrays, and each modulated destination goes out as a CC through
+// the DIN scheduler (so a fast LFO costs at most one pending CC per destination).
+//
+// Rate: |speed| * multiplier / 512 cycles per beat (speed 32, x4 = one cycle per bar), negative
+// speed runs backwards. Multipliers 0-11 follow the host tempo, 12-23 run free at 120 BPM.
+// Fade: |fade| / 16 beats from the last trig; negative fades in, positive fades out.
+//
+// The same parameters drive the device's own LFO (CC 102-109). While the software LFO modulates a
+// track, that track's LFO page CCs are held back and the device gets DEPTH 0, so the modulation is
+// applied once; once it stops (DEPTH 0, or an NRPN-only destination) the device's LFO gets the page back.
+// The modulation is added to the destination's value as the device has it, so during a pattern
+// morph it rides on the morph instead of pulling the destination back to the stored parameter.
+class LfoEngine final
+{
+public:
+    static constexpr int numTracks = TrackParameterSnapshot::numTracks;
+    static constexpr int lanes = TrackParameterSnapshot::trackStride;
+
+    // t{N}_lfoMode choices.
+    enum Mode
+    {
+        freeRunning,
+        trigger,
+        hold,
+        oneShot,
+        halfShot
+    };
+
+    // t{N}_lfoWaveform choices.
+    enum Waveform
+    {
+        triangle,
+        sine,
+        square,
+        saw,
+        envelope,
+        ramp,
+        sampleAndHold,
+        numWaveforms
+    };
+
+    LfoEngine()
+    {
+        reset();
+    }
+
+    void prepare(double)
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        phase.fill(0.0);
+        fadeBeats.fill(0.0);
+        held.fill(0.0);
+        randomValue.fill(0.0);
+        stopped.fill(0);
+        retrigger.fill(0);
+        activeDestination.fill(-1);
+        lastSent.fill(-1);
+        lastBase.fill(-1);
+        zeroedDepth.fill(0);
+
+        for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+            randomState[lane] = 0x9e3779b9u * (juce::uint32) (lane + 1);
+    }
+
+    // Audio thread: a note-on went out on the track's channel this block (a swung note-on counts
+    // in the block the swing queue sends it, not the one it arrived in).
+    void noteOn(int trackIndex0To5) noexcept
+    {
+        retrigger[(size_t) trackIndex0To5] = 1;
+    }
+
+    // Audio thread, before the CC engine renders its changes. Holds back the LFO page CCs of every
+    // track whose LFO runs here, and hands them back to the device's LFO on the others.
+    void holdHardwareLfos(const TrackParameterSnapshot& params, ParameterCcEngine& ccEngine) noexcept
+    {
+        for (int t = 0; t < numTracks; ++t)
+        {
+            const bool owned = destinationOf(params, t) >= 0;
+
+            for (auto field : lfoPageFields)
+                ccEngine.holdBack(ParameterIds::index(t, field), owned);
+        }
+    }
+
+    // Audio thread, once per block after the snapshot has been refreshed and the morph rendered.
+    void render(const TrackParameterSnapshot& params, const PatternMorphEngine& morph,
+                const juce::AudioPlayHead::PositionInfo& position, double sampleRate, int numSamples,
+                DinOutputScheduler& out)
+    {
+        const auto hostBpm = position.getBpm().orFallback(120.0);
+        const double bpm = hostBpm > 0.0 ? hostBpm : 120.0;
+        const auto ppq = position.getPpqPosition();
+        const bool transportLocked = position.getIsPlaying() && ppq.hasValue();
+        const double songBeats = ppq.orFallback(0.0);
+        const double blockMinutes = (double) numSamples / (sampleRate * 60.0);
+
+        const int* const speed = params.row(ParameterIds::lfoSpeed);
+        const int* const multiply = params.row(ParameterIds::lfoMultiply);
+
+        // Pass 1: rates for every lane (straight-line, no per-lane branching).
+        alignas(64) std::array<double, lanes> cyclesPerBeat {};
+        alignas(64) std::array<double, lanes> beatsThisBlock {};
+        alignas(64) std::array<double, lanes> synced {};
+
+        for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+        {
+            const int m = juce::jlimit(0, 23, multiply[lane]);
+            synced[lane] = m < 12 ? 1.0 : 0.0;
+            cyclesPerBeat[lane] = (double) speed[lane] * (double) (1 << (m % 12)) / 512.0;
+            beatsThisBlock[lane] = blockMinutes * (synced[lane] * bpm + (1.0 - synced[lane]) * 120.0);
+        }
+
+        const int* const mode = params.row(ParameterIds::lfoMode);
+        const int* const waveform = params.row(ParameterIds::lfoWaveform);
+        const int* const phaseOffset = params.row(ParameterIds::lfoPhase);
+        const int* const fade = params.row(ParameterIds::lfoFade);
+
+        // Pass 2: trigs. Only tracks that saw a note-on this block do any work here.
+        alignas(64) std::array<juce::uint8, lanes> holdTrig {};
+
+        for (size_t t = 0; t < (size_t) numTracks; ++t)
+        {
+            if (retrigger[t] == 0)
+                continue;
+
+            retrigger[t] = 0;
+            fadeBeats[t] = 0.0;
+
+            if (mode[t] == trigger || mode[t] == oneShot || mode[t] == halfShot)
+            {
+                phase[t] = 0.0;
+                stopped[t] = 0;
+                randomValue[t] = nextRandom(t);
+            }
+            else if (mode[t] == hold)
+            {
+                holdTrig[t] = 1;
+            }
+        }
+
+        // Pass 3: the phase each lane reads. Synced free-running LFOs follow the song position, so
+        // they line up on every playback.
+        alignas(64) std::array<double, lanes> readPhase {};
+
+        for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+        {
+            const bool locked = mode[lane] == freeRunning && synced[lane] != 0.0 && transportLocked;
+            phase[lane] = locked ? wrap(songBeats * cyclesPerBeat[lane]) : phase[lane];
+            readPhase[lane] = wrap(phase[lane] + (double) phaseOffset[lane] / 128.0);
+        }
+
+        // Pass 4: every waveform over every lane, one row each (bipolar rows are -1..1, ENV and
+        // SAW-HLF 0..1), then each lane picks its own row. SIN and ENV are only filled when a lane
+        // uses them.
+        alignas(64) std::array<std::array<double, lanes>, numWaveforms> waves {};
+        juce::uint32 usedWaveforms = 0;
+
+        for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+        {
+            const double p = readPhase[lane];
+            waves[triangle][lane] = 1.0 - 4.0 * std::abs(wrap(p + 0.25) - 0.5);
+            waves[square][lane] = p < 0.5 ? 1.0 : -1.0;
+            waves[saw][lane] = 2.0 * p - 1.0;
+            waves[ramp][lane] = p;
+            waves[sampleAndHold][lane] = randomValue[lane];
+        }
+
+        for (size_t t = 0; t < (size_t) numTracks; ++t)
+            usedWaveforms |= 1u << waveformIndex(waveform[t]);
+
+        if ((usedWaveforms & (1u << sine)) != 0)
+            for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+                waves[sine][lane] = std::sin(juce::MathConstants<double>::twoPi * readPhase[lane]);
+
+        if ((usedWaveforms & (1u << envelope)) != 0)
+            for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+                waves[envelope][lane] = (std::exp(-4.0 * readPhase[lane]) - envelopeFloor) / (1.0 - envelopeFloor);
+
+        // Pass 5: HOLD sampling, fade and phase advance.
+        alignas(64) std::array<double, lanes> modulation {};
+        alignas(64) std::array<juce::uint8, lanes> cycleWrapped {};
+
+        for (size_t lane = 0; lane < (size_t) lanes; ++lane)
+        {
+            const double value = waves[(size_t) waveformIndex(waveform[lane])][lane];
+            held[lane] = holdTrig[lane] != 0 ? value : held[lane];
+
+            const double progress = juce::jmin(1.0, fadeBeats[lane] * 16.0 / (double) juce::jmax(1, std::abs(fade[lane])));
+            const double gain = fade[lane] == 0 ? 1.0 : (fade[lane] < 0 ? progress : 1.0 - progress);
+            modulation[lane] = (mode[lane] == hold ? held[lane] : value) * gain;
+
+            // ONE runs a single cycle, HALF half a cycle, then they rest until the next trig.
+            const double limit = mode[lane] == oneShot ? 1.0 : (mode[lane] == halfShot ? 0.5 : 0.0);
+            const double before = phase[lane];
+            const double after = before + cyclesPerBeat[lane] * beatsThisBlock[lane];
+            const bool hitLimit = stopped[lane] == 0 && limit > 0.0 && std::abs(after) >= limit;
+
+            cycleWrapped[lane] = stopped[lane] == 0 && ! hitLimit && std::floor(after) != std::floor(before) ? 1 : 0;
+            const double running = hitLimit ? (after < 0.0 ? -limit : limit) : (limit > 0.0 ? after : wrap(after));
+            phase[lane] = stopped[lane] != 0 ? before : running;
+            stopped[lane] = hitLimit ? 1 : stopped[lane];
+            fadeBeats[lane] += beatsThisBlock[lane];
+        }
+
+        // S&H draws a new value each time its cycle wraps.
+        for (size_t t = 0; t < (size_t) numTracks; ++t)
+            if (cycleWrapped[t] != 0)
+                randomValue[t] = nextRandom(t);
+
+        // Pass 6: scale onto the destination and queue changed values.
+        for (int t = 0; t < numTracks; ++t)
+        {
+            const int depth = params.get(ParameterIds::lfoDepth, t);
+            const int destination = destinationOf(params, t);
+
+            auto& active = activeDestination[(size_t) t];
+            if (active != destination && active >= 0)
+            {
+                // Hand the previous destination back its unmodulated value.
+                out.queueControlChange(ModelCyclesMidi::trackChannel(t), ModelCyclesMidi::lfoDestinations[active].cc,
+                                       baseValue(params, morph, t, ModelCyclesMidi::lfoDestinations[active]));
+                lastSent[(size_t) t] = -1;
+            }
+
+            active = destination;
+            if (destination < 0)
+            {
+                zeroedDepth[(size_t) t] = 0;
+                continue;
+            }
+
+            // On takeover, and again whenever DEPTH moves (it may have been turned on the device).
+            if (depth != zeroedDepth[(size_t) t])
+            {
+                zeroedDepth[(size_t) t] = depth;
+                out.queueControlChange(ModelCyclesMidi::trackChannel(t), hardwareDepthCc, hardwareDepthOff);
+            }
+
+            const auto& target = ModelCyclesMidi::lfoDestinations[destination];
+            const int base = baseValue(params, morph, t, target);
+            const int value = juce::jlimit(0, 127, base + (int) std::lround((double) depth * modulation[(size_t) t]));
+
+            // A moved base means its own CC (a knob or a morph step) was queued this block, so the
+            // modulated value has to follow it even if it comes out the same.
+            if (value == lastSent[(size_t) t] && base == lastBase[(size_t) t])
+                continue;
+
+            lastSent[(size_t) t] = value;
+            lastBase[(size_t) t] = base;
+            out.queueControlChange(ModelCyclesMidi::trackChannel(t), target.cc, value);
+        }
+    }
+
+private:
+    // The track's LFO page as the device's own LFO receives it.
+    static constexpr ParameterIds::TrackField lfoPageFields[] {
+        ParameterIds::lfoSpeed, ParameterIds::lfoMultiply, ParameterIds::lfoFade, ParameterIds::lfoDestination,
+        ParameterIds::lfoWaveform, ParameterIds::lfoPhase, ParameterIds::lfoMode, ParameterIds::lfoDepth
+    };
+
+    static constexpr int hardwareDepthCc = ModelCyclesMidi::trackCcOf(ParameterIds::lfoDepth);
+    static constexpr int hardwareDepthOff = 64; // DEPTH 0 (-64..63, offset-encoded)
+
+    static double wrap(double p) noexcept
+    {
+        return p - std::floor(p);
+    }
+
+    // Index into lfoDestinations the track's LFO modulates here, or -1 (DEPTH 0 or no CC).
+    static int destinationOf(const TrackParameterSnapshot& params, int track) noexcept
+    {
+        constexpr int numDestinations = (int) (sizeof(ModelCyclesMidi::lfoDestinations) / sizeof(ModelCyclesMidi::lfoDestinations[0]));
+
+        const int destination = juce::jlimit(0, numDestinations - 1, params.get(ParameterIds::lfoDestination, track));
+        if (params.get(ParameterIds::lfoDepth, track) == 0 || ModelCyclesMidi::lfoDestinations[destination].cc < 0)
+            return -1;
+
+        return destination;
+    }
+
+    static int waveformIndex(int choice) noexcept
+    {
+        return juce::jlimit(0, numWaveforms - 1, choice);
+    }
+
+    static int baseValue(const TrackParameterSnapshot& params, const PatternMorphEngine& morph, int track,
+                         const ModelCyclesMidi::LfoDestination& d) noexcept
+    {
+        if (d.baseField < 0)
+            return d.baseOffset;
+
+        const int v = morph.valueOf(params, track, (ParameterIds::TrackField) d.baseField);
+        return d.boolBase ? (v != 0 ? 127 : 0) : v + d.baseOffset;
+    }
+
+    // xorshift32 per lane, mapped to -1..1.
+    double nextRandom(size_t t) noexcept
+    {
+        auto x = randomState[t];
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        randomState[t] = x;
+        return (double) x / 2147483647.5 - 1.0;
+    }
+
+    static constexpr double envelopeFloor = 0.018315638888734; // exp(-4)
+
+    // Audio thread only, one lane per track (padded to the snapshot stride).
+    alignas(64) std::array<double, lanes> phase {};
+    alignas(64) std::array<double, lanes> fadeBeats {};
+    alignas(64) std::array<double, lanes> held {};
+    alignas(64) std::array<double, lanes> randomValue {};
+    std::array<juce::uint32, lanes> randomState {};
+    std::array<juce::uint8, lanes> stopped {};
+    std::array<int, lanes> activeDestination {};
+    std::array<int, lanes> lastSent {};
+    std::array<int, lanes> lastBase {};
+    std::array<int, lanes> zeroedDepth {}; // DEPTH value the device's LFO was last zeroed for (0 = not owned)
+
+    // Set from the MIDI loop, consumed by render() in the same block.
+    std::array<juce::uint8, lanes> retrigger {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LfoEngine)
+};
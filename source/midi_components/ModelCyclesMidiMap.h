@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../ParameterIds.h"
+
+// Model:Cycles MIDI implementation (device manual, appendix "MIDI CC & NRPN").
+// Keep every CC number in this file so the chart can be checked against the manual in one place.
+namespace ModelCyclesMidi
+{
+    constexpr int numTracks = 6;
+
+    // Device defaults: tracks 1-6 listen on channels 1-6, FX parameters on the FX control channel.
+    constexpr int fxChannel = 7;
+
+    // Pattern changes are received as Program Change (bank * 16 + pattern) on the auto channel.
+    constexpr int programChangeChannel = 10;
+
+    constexpr int trackChannel(int trackIndex0To5) { return trackIndex0To5 + 1; }
+
+    enum class CcEncoding
+    {
+        Offset,       // integer value minus the parameter's range start (e.g. -64..63 -> 0..127)
+        Bool,         // off = 0, on = 127
+        InvertedBool, // on = 0, off = 127 (t{N}_unmuted drives the device's MUTE)
+        DelayTime     // free time, or the selected sync step when delay sync is enabled
+    };
+
+    struct CcMapping
+    {
+        int parameter; // ParameterIds::TrackField in trackCcMap, ParameterIds::GlobalParameter in globalCcMap
+        int cc;
+        CcEncoding encoding;
+    };
+
+    // Per-track parameters, keyed by field.
+    // PITCH, the pitch note, SWING and CHANCE are applied to the notes themselves and are not sent as CCs.
+    constexpr CcMapping trackCcMap[] {
+        { ParameterIds::unmuted,        94,  CcEncoding::InvertedBool },
+        { ParameterIds::mixVolume,      95,  CcEncoding::Offset },
+        { ParameterIds::mixPan,         10,  CcEncoding::Offset },
+        { ParameterIds::machine,        64,  CcEncoding::Offset },
+        { ParameterIds::punch,          66,  CcEncoding::Bool },
+        { ParameterIds::gate,           67,  CcEncoding::Bool },
+        { ParameterIds::decay,          80,  CcEncoding::Offset },
+        { ParameterIds::color,          16,  CcEncoding::Offset },
+        { ParameterIds::shape,          17,  CcEncoding::Offset },
+        { ParameterIds::sweep,          18,  CcEncoding::Offset },
+        { ParameterIds::contour,        19,  CcEncoding::Offset },
+        { ParameterIds::delaySend,      12,  CcEncoding::Offset },
+        { ParameterIds::reverbSend,     13,  CcEncoding::Offset },
+        { ParameterIds::volDist,        7,   CcEncoding::Offset },
+        { ParameterIds::lfoSpeed,       102, CcEncoding::Offset },
+        { ParameterIds::lfoMultiply,    103, CcEncoding::Offset },
+        { ParameterIds::lfoFade,        104, CcEncoding::Offset },
+        { ParameterIds::lfoDestination, 105, CcEncoding::Offset },
+        { ParameterIds::lfoWaveform,    106, CcEncoding::Offset },
+        { ParameterIds::lfoPhase,       107, CcEncoding::Offset },
+        { ParameterIds::lfoMode,        108, CcEncoding::Offset },
+        { ParameterIds::lfoDepth,       109, CcEncoding::Offset },
+    };
+
+    // CC of a track field in trackCcMap, or -1 if it has none.
+    constexpr int trackCcOf(int field)
+    {
+        for (const auto& m : trackCcMap)
+            if (m.parameter == field)
+                return m.cc;
+
+        return -1;
+    }
+
+    // Global parameters (sent on the FX channel).
+    constexpr CcMapping globalCcMap[] {
+        { ParameterIds::delayTimeFreeGlobal,  85, CcEncoding::DelayTime },
+        { ParameterIds::delayFeedbackOverlay, 86, CcEncoding::Offset },
+        { ParameterIds::reverbSizeGlobal,     87, CcEncoding::Offset },
+        { ParameterIds::reverbToneOverlay,    88, CcEncoding::Offset },
+    };
+
+    // Software LFO destinations, in t{N}_lfoDestination choice order. The modulation is added to the
+    // destination's current value (baseField, encoded like its CC) or to a fixed centre when the
+    // parameter has no CC of its own. cc < 0: no CC on the device (FTUN and PAW are NRPN-only), so
+    // those destinations are left to the device's own LFO, which the t{N}_lfo* CCs above drive.
+    struct LfoDestination
+    {
+        int cc;
+        int baseField;  // ParameterIds::TrackField, or -1 to modulate around baseOffset
+        int baseOffset; // added to the field value (maps -64..63 ranges onto 0..127)
+        bool boolBase;  // base is a toggle: off = 0, on = 127
+    };
+
+    constexpr LfoDestination lfoDestinations[] {
+        { -1, -1,                       0,  false }, // ---
+        { 65, -1,                       64, false }, // PTCH (track pitch is applied to notes; modulate around centre)
+        { -1, -1,                       0,  false }, // FTUN
+        { 80, ParameterIds::decay,      0,  false }, // DEC
+        { 16, ParameterIds::color,      0,  false }, // COLR
+        { 17, ParameterIds::shape,      0,  false }, // SHPE
+        { 18, ParameterIds::sweep,      0,  false }, // SWEP
+        { 19, ParameterIds::contour,    0,  false }, // CONT
+        { 12, ParameterIds::delaySend,  0,  false }, // DELS
+        { 13, ParameterIds::reverbSend, 0,  false }, // REVS
+        { 7,  ParameterIds::volDist,    0,  false }, // DIST
+        { 10, ParameterIds::mixPan,     64, false }, // PAN
+        { -1, -1,                       0,  false }, // PAW
+        { 67, ParameterIds::gate,       0,  true  }, // GATE
+    };
+
+    // DELAY TIME sync steps (delayTimeSyncIndexGlobal). The device shows delay time as 1..128.
+    constexpr int delaySyncSteps[] { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
+    constexpr int numDelaySyncSteps = (int) (sizeof(delaySyncSteps) / sizeof(int));
+
+    // Index of the sync step nearest a DELAY TIME CC value (0-127 = 1..128), ties to the shorter.
+    constexpr int nearestDelaySyncStep(int ccValue)
+    {
+        int best = 0;
+        for (int i = 1; i < numDelaySyncSteps; ++i)
+        {
+            const int distance = delaySyncSteps[i] - 1 - ccValue;
+            const int bestDistance = delaySyncSteps[best] - 1 - ccValue;
+            if ((distance < 0 ? -distance : distance) < (bestDistance < 0 ? -bestDistance : bestDistance))
+                best = i;
+        }
+
+        return best;
+    }
+} // namespace ModelCyclesMidi
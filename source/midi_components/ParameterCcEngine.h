@@ -0,0 +1,293 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "DinOutputScheduler.h"
+#include "ModelCyclesMidiMap.h"
+
+// Sends a CC to the Model:Cycles whenever a mapped parameter changes.
+// Parameter listeners (any thread) only set a bit in a lock-free dirty set. The audio thread walks
+// the set bits once per block, so a quiet block costs a handful of atomic exchanges no matter how
+// many parameters exist, and a busy block costs O(changed parameters).
+class ParameterCcEngine final : private juce::AudioProcessorParameter::Listener
+{
+public:
+    static constexpr int maxParameters = 256;
+    static_assert(ParameterIds::numParameters <= maxParameters, "grow maxParameters");
+
+    ParameterCcEngine() = default;
+
+    ~ParameterCcEngine() override
+    {
+        detach();
+    }
+
+    // Message thread, before processing starts. Caches the raw value pointers and the CC routing
+    // for every mapped parameter (slots are addressed by ParameterIds dense index, which is also the
+    // listener's parameter index), then starts listening for changes. The first renderChanges()
+    // sends every mapped parameter, so the device starts out matching the plug-in.
+    void attach(juce::AudioProcessor& processorToUse, juce::AudioProcessorValueTreeState& apvts)
+    {
+        detach();
+
+        slots = {};
+        dirtyTarget.fill(-1);
+        lastSent.fill(-1);
+        heldBack.fill(0);
+        slotForCc.fill(-1);
+        mapped.fill(0);
+
+        auto addSlot = [&] (int index, const char* id, int channel, const ModelCyclesMidi::CcMapping& mapping)
+        {
+            auto* ranged = apvts.getParameter(id);
+            auto* value = apvts.getRawParameterValue(id);
+            if (ranged == nullptr || value == nullptr || index >= maxParameters)
+                return;
+
+            auto& slot = slots[(size_t) index];
+            slot.value = value;
+            slot.channel = channel;
+            slot.cc = mapping.cc;
+            slot.encoding = mapping.encoding;
+            slot.rangeStart = (int) std::lround(ranged->getNormalisableRange().start);
+            slot.rangeEnd = (int) std::lround(ranged->getNormalisableRange().end);
+
+            dirtyTarget[(size_t) index] = index;
+            mapped[(size_t) index >> 6] |= (juce::uint64) 1 << (index & 63);
+            slotForCc[(size_t) ((channel - 1) * 128 + mapping.cc)] = (juce::int16) index;
+        };
+
+        for (int track = 0; track < ParameterIds::numTracks; ++track)
+            for (const auto& m : ModelCyclesMidi::trackCcMap)
+            {
+                const auto field = (ParameterIds::TrackField) m.parameter;
+                addSlot(ParameterIds::index(track, field), ParameterIds::trackId(track, field),
+                        ModelCyclesMidi::trackChannel(track), m);
+            }
+
+        for (const auto& m : ModelCyclesMidi::globalCcMap)
+        {
+            const auto p = (ParameterIds::GlobalParameter) m.parameter;
+            addSlot(ParameterIds::index(p), ParameterIds::globalId(p), ModelCyclesMidi::fxChannel, m);
+        }
+
+        // The sync toggle and sync step have no CC of their own; they re-send DELAY TIME.
+        delaySyncEnabled = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::delayTimeSyncEnabled));
+        delaySyncIndex = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::delayTimeSyncIndexGlobal));
+
+        const int delayTimeIndex = ParameterIds::index(ParameterIds::delayTimeFreeGlobal);
+        if (dirtyTarget[(size_t) delayTimeIndex] >= 0)
+        {
+            dirtyTarget[(size_t) ParameterIds::index(ParameterIds::delayTimeSyncEnabled)] = delayTimeIndex;
+            dirtyTarget[(size_t) ParameterIds::index(ParameterIds::delayTimeSyncIndexGlobal)] = delayTimeIndex;
+        }
+
+        for (auto& word : dirty)
+            word.store(0, std::memory_order_relaxed);
+
+        resendPending.store(true, std::memory_order_release);
+
+        processor = &processorToUse;
+        for (auto* p : processor->getParameters())
+            p->addListener(this);
+    }
+
+    void detach()
+    {
+        if (processor == nullptr)
+            return;
+
+        for (auto* p : processor->getParameters())
+            p->removeListener(this);
+
+        processor = nullptr;
+    }
+
+    // Any thread. The next renderChanges() sends every mapped parameter, changed or not, so the
+    // device matches the plug-in again after a state restore or kit recall.
+    void resendAll() noexcept
+    {
+        resendPending.store(true, std::memory_order_release);
+    }
+
+    // Audio thread. Queues one CC per mapped parameter whose encoded value changed since it was last
+    // sent (or, after resendAll(), one per mapped parameter; the DIN scheduler paces the dump).
+    void renderChanges(DinOutputScheduler& out)
+    {
+        const bool resend = resendPending.exchange(false, std::memory_order_acquire);
+        if (resend)
+            lastSent.fill(-1);
+
+        for (size_t w = 0; w < dirty.size(); ++w)
+        {
+            auto bits = dirty[w].exchange(0, std::memory_order_acquire) | (resend ? mapped[w] : 0);
+
+            while (bits != 0)
+            {
+                const auto lowest = bits & (~bits + 1);
+                bits ^= lowest;
+
+                const auto index = w * 64 + (size_t) juce::countNumberOfBits(lowest - 1);
+                if (heldBack[index] != 0)
+                    continue;
+
+                const auto& slot = slots[index];
+                const int value = encode(slot);
+
+                if (value == lastSent[index])
+                    continue;
+
+                lastSent[index] = (juce::int16) value;
+
+                out.queueControlChange(slot.channel, slot.cc, value);
+            }
+        }
+    }
+
+    // Audio thread. Dense parameter index a CC received from the device maps to, or -1.
+    int findSlot(int channel1To16, int cc) const noexcept
+    {
+        return slotForCc[(size_t) ((((channel1To16 - 1) & 0x0f) * 128) + (cc & 0x7f))];
+    }
+
+    // Any thread (fixed after attach).
+    ModelCyclesMidi::CcEncoding encodingOf(int index) const noexcept
+    {
+        return slots[(size_t) index].encoding;
+    }
+
+    // Audio thread. The device already has this value, so the parameter change it causes must not
+    // be sent back to it. What is recorded is the value renderChanges() will encode once the
+    // parameter has taken the CC (e.g. 127 for any "on" value of a toggle), not the raw byte.
+    void markReceived(int index, int ccValue) noexcept
+    {
+        lastSent[(size_t) index] = (juce::int16) normalise(slots[(size_t) index], ccValue);
+    }
+
+    // Audio thread. While a slot is held back its changes are not sent, so the device keeps what it
+    // last received. Letting it go sends the parameter's current value in the next renderChanges().
+    void holdBack(int index, bool shouldHold) noexcept
+    {
+        auto& held = heldBack[(size_t) index];
+        if ((held != 0) == shouldHold)
+            return;
+
+        held = shouldHold ? 1 : 0;
+
+        if (! shouldHold && dirtyTarget[(size_t) index] >= 0)
+        {
+            lastSent[(size_t) index] = -1;
+            dirty[(size_t) index >> 6].fetch_or((juce::uint64) 1 << (index & 63), std::memory_order_release);
+        }
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<float>* value { nullptr };
+        int channel { 0 };
+        int cc { 0 };
+        ModelCyclesMidi::CcEncoding encoding { ModelCyclesMidi::CcEncoding::Offset };
+        int rangeStart { 0 };
+        int rangeEnd { 127 };
+    };
+
+    void parameterValueChanged(int parameterIndex, float newValue) override
+    {
+        juce::ignoreUnused(newValue);
+
+        if (parameterIndex < 0 || parameterIndex >= maxParameters)
+            return;
+
+        const int target = dirtyTarget[(size_t) parameterIndex];
+        if (target < 0)
+            return;
+
+        dirty[(size_t) target >> 6].fetch_or((juce::uint64) 1 << (target & 63), std::memory_order_release);
+    }
+
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override
+    {
+        juce::ignoreUnused(parameterIndex, gestureIsStarting);
+    }
+
+    // A received CC value decoded the way IncomingCcSync applies it, then encoded as encode() would.
+    int normalise(const Slot& slot, int ccValue) const noexcept
+    {
+        switch (slot.encoding)
+        {
+            case ModelCyclesMidi::CcEncoding::Bool:
+            case ModelCyclesMidi::CcEncoding::InvertedBool:
+                return ccValue >= 64 ? 127 : 0;
+
+            case ModelCyclesMidi::CcEncoding::DelayTime:
+                if (delaySyncEnabled != nullptr && delaySyncEnabled->load(std::memory_order_relaxed) >= 0.5f)
+                    return ModelCyclesMidi::delaySyncSteps[ModelCyclesMidi::nearestDelaySyncStep(ccValue)] - 1;
+                break;
+
+            case ModelCyclesMidi::CcEncoding::Offset:
+                break;
+        }
+
+        const int plain = juce::jlimit(slot.rangeStart, slot.rangeEnd, (ccValue & 0x7f) + slot.rangeStart);
+        return juce::jlimit(0, 127, plain - slot.rangeStart);
+    }
+
+    int encode(const Slot& slot) const noexcept
+    {
+        const float v = slot.value->load(std::memory_order_relaxed);
+
+        switch (slot.encoding)
+        {
+            case ModelCyclesMidi::CcEncoding::Bool:
+                return v >= 0.5f ? 127 : 0;
+
+            case ModelCyclesMidi::CcEncoding::InvertedBool:
+                return v >= 0.5f ? 0 : 127;
+
+            case ModelCyclesMidi::CcEncoding::DelayTime:
+                if (delaySyncEnabled != nullptr && delaySyncIndex != nullptr
+                    && delaySyncEnabled->load(std::memory_order_relaxed) >= 0.5f)
+                {
+                    const int step = juce::jlimit(0, ModelCyclesMidi::numDelaySyncSteps - 1,
+                                                  (int) std::lround(delaySyncIndex->load(std::memory_order_relaxed)));
+                    return ModelCyclesMidi::delaySyncSteps[step] - 1;
+                }
+                break;
+
+            case ModelCyclesMidi::CcEncoding::Offset:
+                break;
+        }
+
+        return juce::jlimit(0, 127, (int) std::lround(v) - slot.rangeStart);
+    }
+
+    juce::AudioProcessor* processor { nullptr };
+
+    std::array<Slot, maxParameters> slots {};
+
+    // Listener index -> slot whose CC must be re-sent (-1 = unmapped). Written only in attach().
+    std::array<int, maxParameters> dirtyTarget {};
+
+    std::array<std::atomic<juce::uint64>, maxParameters / 64> dirty {};
+    std::atomic<bool> resendPending { false };
+
+    // One bit per mapped slot. Written only in attach().
+    std::array<juce::uint64, maxParameters / 64> mapped {};
+
+    // (channel - 1) * 128 + cc -> slot index (-1 = unmapped). Written only in attach().
+    std::array<juce::int16, 16 * 128> slotForCc {};
+
+    // Audio-thread only: last value sent per slot (-1 = never sent), and the slots held back.
+    std::array<juce::int16, maxParameters> lastSent {};
+    std::array<juce::uint8, maxParameters> heldBack {};
+
+    std::atomic<float>* delaySyncEnabled { nullptr };
+    std::atomic<float>* delaySyncIndex { nullptr };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterCcEngine)
+};
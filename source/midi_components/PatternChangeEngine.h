@@ -0,0 +1,131 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <atomic>
+#include <cmath>
+
+#include "../ParameterIds.h"
+#include "ModelCyclesMidiMap.h"
+
+// Sends the Pattern Bank / Pattern selection as a Program Change, quantized to the host's grid.
+// A change made mid-bar waits in a single pending slot (a newer selection replaces it) and goes
+// out at the sample where the next boundary falls. With the transport stopped, or without tempo
+// information, it is sent at the start of the next block.
+class PatternChangeEngine final
+{
+public:
+    // Choices of the patternChangeQuantum parameter.
+    enum Quantum
+    {
+        beat,
+        bar,
+        twoBars,
+        fourBars
+    };
+
+    PatternChangeEngine() = default;
+
+    // Message thread, before processing starts. The current selection counts as already sent.
+    void attach(juce::AudioProcessorValueTreeState& apvts)
+    {
+        bank = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::patternBankGlobal));
+        index = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::patternIndexGlobal));
+        quantum = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::patternChangeQuantum));
+
+        lastRequested = currentProgram();
+        sentProgram = lastRequested;
+        pendingProgram = -1;
+    }
+
+    // Audio thread. Adds the Program Change to `midi` if a boundary falls inside this block and
+    // returns its sample offset, or -1 if nothing was sent.
+    int render(const juce::AudioPlayHead::PositionInfo& position, double sampleRate, int numSamples,
+                juce::MidiBuffer& midi)
+    {
+        const int requested = currentProgram();
+        if (requested != lastRequested)
+        {
+            lastRequested = requested;
+            pendingProgram = requested;
+        }
+
+        if (pendingProgram < 0 || requested < 0)
+            return -1;
+
+        const int offset = samplesToNextBoundary(position, sampleRate);
+        if (offset >= numSamples)
+            return -1;
+
+        const auto message = juce::MidiMessage::programChange(ModelCyclesMidi::programChangeChannel, pendingProgram);
+        midi.addEvent(message, juce::jmax(0, offset));
+        sentProgram = pendingProgram;
+        pendingProgram = -1;
+        return juce::jmax(0, offset);
+    }
+
+    // Audio thread. The pattern the device was last switched to (bank * 16 + pattern).
+    int getSentProgram() const noexcept { return sentProgram; }
+
+private:
+    int currentProgram() const noexcept
+    {
+        if (bank == nullptr || index == nullptr)
+            return -1;
+
+        const int b = (int) std::lround(bank->load(std::memory_order_relaxed));
+        const int i = (int) std::lround(index->load(std::memory_order_relaxed));
+        return juce::jlimit(0, 127, b * 16 + i);
+    }
+
+    // Sample offset (from the start of this block) of the next quantum boundary, or 0 to send now.
+    int samplesToNextBoundary(const juce::AudioPlayHead::PositionInfo& position, double sampleRate) const
+    {
+        const auto ppq = position.getPpqPosition();
+        const auto bpm = position.getBpm();
+
+        if (! position.getIsPlaying() || ! ppq.hasValue() || ! bpm.hasValue() || *bpm <= 0.0)
+            return 0;
+
+        int numerator = 4, denominator = 4;
+        if (const auto sig = position.getTimeSignature())
+        {
+            numerator = juce::jmax(1, sig->numerator);
+            denominator = juce::jmax(1, sig->denominator);
+        }
+
+        const double beatLength = 4.0 / (double) denominator;
+        const double barLength = beatLength * (double) numerator;
+        const int q = quantum != nullptr ? (int) std::lround(quantum->load(std::memory_order_relaxed)) : bar;
+
+        double gridLength = barLength;
+        switch (q)
+        {
+            case beat:     gridLength = beatLength; break;
+            case twoBars:  gridLength = barLength * 2.0; break;
+            case fourBars: gridLength = barLength * 4.0; break;
+            default:       break;
+        }
+
+        // Beats and bars are counted from the last bar start when the host reports it.
+        const double origin = q == beat || q == bar ? position.getPpqPositionOfLastBarStart().orFallback(0.0) : 0.0;
+
+        // A boundary landing exactly on the block start counts as this block.
+        const double steps = std::ceil((*ppq - origin) / gridLength - 1.0e-9);
+        const double boundary = origin + steps * gridLength;
+        const double samplesPerQuarter = sampleRate * 60.0 / *bpm;
+
+        return (int) std::floor((boundary - *ppq) * samplesPerQuarter);
+    }
+
+    std::atomic<float>* bank { nullptr };
+    std::atomic<float>* index { nullptr };
+    std::atomic<float>* quantum { nullptr };
+
+    // Audio thread only.
+    int lastRequested { -1 };
+    int pendingProgram { -1 };
+    int sentProgram { -1 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternChangeEngine)
+};
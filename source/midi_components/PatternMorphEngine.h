@@ -0,0 +1,257 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "../ParameterIds.h"
+#include "../PatternSnapshotStore.h"
+#include "../TrackParameterSnapshot.h"
+#include "DinOutputScheduler.h"
+#include "IncomingCcSync.h"
+#include "ModelCyclesMidiMap.h"
+#include "ParameterCcEngine.h"
+
+// On every pattern change, stores the tracks' values as the snapshot of the pattern being left and
+// moves them to the snapshot of the newly selected pattern over patternMorphBars bars, starting at
+// the sample the Program Change went out. With the parameter at OFF (the default) the move takes
+// no time: the snapshot is recalled in the first block after the change.
+//
+// A morph is a list of lanes, one per CC-mapped track field whose value differs between the two
+// sets; unchanged fields cost nothing. Each block evaluates every lane once and queues a CC only
+// when its encoded (0-127) value moved, so a slow morph adds a handful of CCs per block at most.
+// Integer fields interpolate; toggles and choices (machine, LFO mode, ...) switch at the end.
+// On arrival the parameters themselves take the target values through the incoming-CC path, with
+// the CC engine told the device already has them.
+class PatternMorphEngine final
+{
+public:
+    static constexpr int numTracks = ParameterIds::numTracks;
+    static constexpr int numFields = ParameterIds::numTrackFields;
+    static constexpr int numValues = numTracks * numFields;
+
+    // Bars per choice of the patternMorphBars parameter (choice 0 = OFF).
+    static constexpr int barChoices[] { 0, 1, 2, 4, 8 };
+
+    PatternMorphEngine() = default;
+
+    // Message thread, before processing starts.
+    void attach(juce::AudioProcessorValueTreeState& apvts)
+    {
+        morphBars = apvts.getRawParameterValue(ParameterIds::globalId(ParameterIds::patternMorphBars));
+
+        for (int f = 0; f < numFields; ++f)
+        {
+            auto* param = apvts.getParameter(ParameterIds::trackId(0, (ParameterIds::TrackField) f));
+            rangeStart[(size_t) f] = param != nullptr ? (int) std::lround(param->getNormalisableRange().start) : 0;
+            interpolates[(size_t) f] = dynamic_cast<juce::AudioParameterInt*>(param) != nullptr;
+            ccOf[(size_t) f] = -1;
+            encodingOf[(size_t) f] = ModelCyclesMidi::CcEncoding::Offset;
+        }
+
+        for (const auto& m : ModelCyclesMidi::trackCcMap)
+        {
+            ccOf[(size_t) m.parameter] = m.cc;
+            encodingOf[(size_t) m.parameter] = m.encoding;
+        }
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        active = false;
+        numLanes = 0;
+        settleSamplesLeft = 0;
+    }
+
+    bool isMorphing() const noexcept { return active; }
+
+    // Audio thread. A track field's plain value as the device has it: the morph's value while a
+    // morph runs (and after it, until the parameters have taken its target), otherwise the parameter.
+    int valueOf(const TrackParameterSnapshot& params, int trackIndex0To5, ParameterIds::TrackField field) const noexcept
+    {
+        if (active || settleSamplesLeft > 0)
+            return current[(size_t) (trackIndex0To5 * numFields + (int) field)];
+
+        return params.get(field, trackIndex0To5);
+    }
+
+    // Audio thread. The pattern selection went from `fromSlot` to `toSlot` at `samplePosition` in
+    // this block. Stores what the old pattern sounded like and starts the morph to the new one
+    // (zero bars long while morphing is OFF).
+    void patternChanged(int fromSlot, int toSlot, int samplePosition, PatternSnapshotStore& store,
+                        const TrackParameterSnapshot& params, const juce::AudioPlayHead::PositionInfo& position)
+    {
+        constexpr int numChoices = (int) (sizeof(barChoices) / sizeof(int));
+        const int choice = morphBars != nullptr ? (int) std::lround(morphBars->load(std::memory_order_relaxed)) : 0;
+        const int bars = barChoices[juce::jlimit(0, numChoices - 1, choice)];
+
+        // Mid-morph the parameters still hold the pre-morph values and the old slot already holds
+        // the morph's target, so the morph continues from where it has got to instead.
+        if (! active)
+        {
+            store.capture(fromSlot, params);
+
+            for (int t = 0; t < numTracks; ++t)
+                for (int f = 0; f < numFields; ++f)
+                    current[(size_t) (t * numFields + f)] = params.get((ParameterIds::TrackField) f, t);
+        }
+
+        // A pattern without a snapshot keeps the current values (and settles the parameters on
+        // them if a morph was cut short).
+        const bool hasTarget = store.has(toSlot);
+        numLanes = 0;
+
+        for (int t = 0; t < numTracks; ++t)
+            for (int f = 0; f < numFields; ++f)
+            {
+                const auto i = (size_t) (t * numFields + f);
+                target[i] = hasTarget ? store.get(toSlot, t, (ParameterIds::TrackField) f) : current[i];
+
+                if (ccOf[(size_t) f] < 0 || target[i] == current[i])
+                    continue;
+
+                auto& lane = lanes[(size_t) numLanes++];
+                lane.track = t;
+                lane.field = f;
+                lane.from = current[i];
+                lane.to = target[i];
+                lane.lastSent = encode(f, current[i]);
+            }
+
+        int numerator = 4, denominator = 4;
+        if (const auto sig = position.getTimeSignature())
+        {
+            numerator = juce::jmax(1, sig->numerator);
+            denominator = juce::jmax(1, sig->denominator);
+        }
+
+        lengthQuarters = (double) bars * 4.0 * (double) numerator / (double) denominator;
+        elapsedQuarters = 0.0;
+        startOffset = juce::jmax(0, samplePosition);
+        active = true;
+    }
+
+    // Audio thread, once per block after patternChanged().
+    void render(const TrackParameterSnapshot& params, const juce::AudioPlayHead::PositionInfo& position,
+                double sampleRate, int numSamples, DinOutputScheduler& out, ParameterCcEngine& ccEngine,
+                IncomingCcSync& toParameters)
+    {
+        if (! active)
+        {
+            // The target reaches the parameters through the message thread. Until it has (or, if a
+            // knob moved meanwhile, for a quarter of a second at most) valueOf() keeps answering with it.
+            if (settleSamplesLeft > 0)
+                settleSamplesLeft = parametersAtTarget(params) ? 0 : settleSamplesLeft - numSamples;
+
+            return;
+        }
+
+        const auto hostBpm = position.getBpm().orFallback(120.0);
+        const double bpm = hostBpm > 0.0 ? hostBpm : 120.0;
+
+        elapsedQuarters += (double) juce::jmax(0, numSamples - startOffset) * bpm / (60.0 * sampleRate);
+        startOffset = 0;
+
+        const double progress = lengthQuarters > 0.0 ? juce::jmin(1.0, elapsedQuarters / lengthQuarters) : 1.0;
+
+        for (int l = 0; l < numLanes; ++l)
+        {
+            auto& lane = lanes[(size_t) l];
+
+            const int plain = interpolates[(size_t) lane.field]
+                                  ? lane.from + (int) std::lround((double) (lane.to - lane.from) * progress)
+                                  : (progress >= 1.0 ? lane.to : lane.from);
+
+            current[(size_t) (lane.track * numFields + lane.field)] = plain;
+
+            const int value = encode(lane.field, plain);
+            if (value == lane.lastSent)
+                continue;
+
+            lane.lastSent = value;
+            out.queueControlChange(ModelCyclesMidi::trackChannel(lane.track), ccOf[(size_t) lane.field], value);
+            ccEngine.markReceived(ParameterIds::index(lane.track, (ParameterIds::TrackField) lane.field), value);
+        }
+
+        if (progress < 1.0)
+            return;
+
+        // Arrived: hand the target to the parameters (fields without a CC, such as PITCH or CHANCE,
+        // change here too).
+        settleSamplesLeft = (int) (sampleRate * 0.25);
+
+        for (int t = 0; t < numTracks; ++t)
+            for (int f = 0; f < numFields; ++f)
+            {
+                const auto i = (size_t) (t * numFields + f);
+                current[i] = target[i];
+
+                if (target[i] != params.get((ParameterIds::TrackField) f, t))
+                    toParameters.push(ParameterIds::index(t, (ParameterIds::TrackField) f), encode(f, target[i]), encodingOf[(size_t) f]);
+            }
+
+        active = false;
+        numLanes = 0;
+    }
+
+private:
+    struct Lane
+    {
+        int track;
+        int field;
+        int from;
+        int to;
+        int lastSent;
+    };
+
+    bool parametersAtTarget(const TrackParameterSnapshot& params) const noexcept
+    {
+        for (int t = 0; t < numTracks; ++t)
+            for (int f = 0; f < numFields; ++f)
+                if (target[(size_t) (t * numFields + f)] != params.get((ParameterIds::TrackField) f, t))
+                    return false;
+
+        return true;
+    }
+
+    // Plain value -> 0-127, as the CC engine sends it (and IncomingCcSync decodes it).
+    int encode(int field, int plain) const noexcept
+    {
+        switch (encodingOf[(size_t) field])
+        {
+            case ModelCyclesMidi::CcEncoding::Bool:         return plain != 0 ? 127 : 0;
+            case ModelCyclesMidi::CcEncoding::InvertedBool: return plain != 0 ? 0 : 127;
+            case ModelCyclesMidi::CcEncoding::DelayTime:
+            case ModelCyclesMidi::CcEncoding::Offset:       break;
+        }
+
+        return juce::jlimit(0, 127, plain - rangeStart[(size_t) field]);
+    }
+
+    std::atomic<float>* morphBars { nullptr };
+
+    // Per track field, fixed after attach(). ccOf is -1 for fields that have no CC.
+    std::array<int, numFields> rangeStart {};
+    std::array<bool, numFields> interpolates {};
+    std::array<int, numFields> ccOf {};
+    std::array<ModelCyclesMidi::CcEncoding, numFields> encodingOf {};
+
+    // Audio thread only. Plain values, track-major in ParameterIds field order.
+    std::array<int, numValues> current {};
+    std::array<int, numValues> target {};
+
+    std::array<Lane, numValues> lanes {};
+    int numLanes { 0 };
+
+    bool active { false };
+    double lengthQuarters { 0.0 };
+    double elapsedQuarters { 0.0 };
+    int startOffset { 0 };
+    int settleSamplesLeft { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatternMorphEngine)
+};
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+
+#include "../ParameterIds.h"
+#include "../TrackParameterSnapshot.h"
+
+// Applies t{N}_swing: note-ons that fall on an off-beat 16th (from the host playhead) are delayed
+// by swing / 127 * 0.3 of an eighth note (127 = the device's 80% swing), and each note's note-off
+// is delayed by the same amount so lengths and on/off order are preserved.
+// Delayed events wait in a fixed per-track queue keyed by an internal absolute sample counter and
+// are emitted at their exact sample in whichever later block they fall. Nothing is allocated, so
+// memory does not depend on tempo or buffer size.
+class SwingEngine final
+{
+public:
+    static constexpr int numTracks = TrackParameterSnapshot::numTracks;
+
+    // Per track. Far more than the events that fit in one swing delay; if it ever fills, further
+    // events pass through undelayed rather than being lost.
+    static constexpr int queueCapacity = 256;
+
+    struct Stats
+    {
+        // Events that found their track's queue full and went out undelayed.
+        std::atomic<juce::uint64> eventsOverflowed { 0 };
+    };
+
+    SwingEngine()
+    {
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto& q : queues)
+        {
+            q.head = 0;
+            q.count = 0;
+        }
+
+        noteDelay.fill(0);
+        samplesProcessed = 0;
+        wasPlaying = false;
+    }
+
+    // Audio thread, before the block's events are passed to take().
+    void beginBlock(const TrackParameterSnapshot& params, const juce::AudioPlayHead::PositionInfo& position,
+                    double sampleRate)
+    {
+        const auto ppq = position.getPpqPosition();
+        const auto bpm = position.getBpm();
+
+        playing = position.getIsPlaying() && ppq.hasValue() && bpm.hasValue() && *bpm > 0.0;
+
+        // Stopping releases everything still waiting, so nothing is left hanging.
+        flushAll = wasPlaying && ! playing;
+        wasPlaying = playing;
+
+        if (! playing)
+            return;
+
+        blockPpq = *ppq;
+        samplesPerQuarter = sampleRate * 60.0 / *bpm;
+
+        const int* const swing = params.row(ParameterIds::swing);
+        for (size_t t = 0; t < (size_t) numTracks; ++t)
+            swingDelay[t] = (int) std::lround((double) juce::jlimit(0, 127, swing[t]) / 127.0 * 0.3 * samplesPerQuarter * 0.5);
+    }
+
+    // Audio thread. Returns true if the note event was moved into the delay queue; the caller then
+    // removes it from the block.
+    bool take(int trackIndex0To5, bool isNoteOn, const juce::uint8* bytes, int samplePosition) noexcept
+    {
+        auto& delay = noteDelay[(size_t) (trackIndex0To5 * 128 + (bytes[1] & 0x7f))];
+        int eventDelay = delay;
+
+        if (isNoteOn)
+        {
+            delay = 0;
+
+            if (! playing || swingDelay[(size_t) trackIndex0To5] == 0)
+                return false;
+
+            const double eventPpq = blockPpq + (double) samplePosition / samplesPerQuarter;
+            const auto sixteenth = (juce::int64) std::floor(eventPpq * 4.0 + 1.0e-6);
+            if ((sixteenth & 1) == 0)
+                return false;
+
+            eventDelay = swingDelay[(size_t) trackIndex0To5];
+        }
+        else
+        {
+            delay = 0;
+
+            if (eventDelay == 0)
+                return false;
+        }
+
+        // A full queue lets the event through undelayed; the note-on's delay is only recorded once
+        // it is queued, so its note-off then passes undelayed too.
+        if (! queues[(size_t) trackIndex0To5].insert(samplesProcessed + samplePosition + eventDelay, bytes))
+        {
+            stats.eventsOverflowed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (isNoteOn)
+            delay = eventDelay;
+
+        return true;
+    }
+
+    // Any thread.
+    const Stats& getStats() const noexcept { return stats; }
+
+    // Audio thread, before renderDue(). The track was muted: its waiting note-ons are dropped and
+    // its waiting note-offs (whose note-ons already went out) are added at `samplePosition`.
+    void releaseTrack(int trackIndex0To5, juce::MidiBuffer& midi, int samplePosition)
+    {
+        auto& q = queues[(size_t) trackIndex0To5];
+
+        while (q.count > 0)
+        {
+            const auto& e = q.front();
+            if (! ((e.bytes[0] & 0xf0) == 0x90 && e.bytes[2] != 0))
+                midi.addEvent(e.bytes, 3, samplePosition);
+
+            q.popFront();
+        }
+
+        const auto first = noteDelay.begin() + trackIndex0To5 * 128;
+        std::fill(first, first + 128, 0);
+    }
+
+    // Audio thread, after the block's events. Adds every queued event due in this block at its
+    // exact offset, then advances the sample counter. noteOnSent(track) is called for every note-on
+    // that goes out.
+    template <typename NoteOnCallback>
+    void renderDue(juce::MidiBuffer& midi, int numSamples, NoteOnCallback&& noteOnSent)
+    {
+        const auto blockEnd = samplesProcessed + numSamples;
+
+        for (size_t t = 0; t < queues.size(); ++t)
+        {
+            auto& q = queues[t];
+
+            while (q.count > 0 && (flushAll || q.front().due < blockEnd))
+            {
+                const auto& e = q.front();
+                const auto offset = flushAll ? 0 : juce::jmax((juce::int64) 0, e.due - samplesProcessed);
+                midi.addEvent(e.bytes, 3, (int) offset);
+
+                if ((e.bytes[0] & 0xf0) == 0x90 && e.bytes[2] != 0)
+                    noteOnSent((int) t);
+
+                q.popFront();
+            }
+        }
+
+        samplesProcessed = blockEnd;
+    }
+
+private:
+    struct Event
+    {
+        juce::int64 due;
+        juce::uint8 bytes[3];
+    };
+
+    // Ring buffer kept sorted by due time (stable for equal times, so on/off order survives).
+    struct Queue
+    {
+        std::array<Event, queueCapacity> events {};
+        int head { 0 };
+        int count { 0 };
+
+        Event& at(int i) noexcept { return events[(size_t) ((head + i) % queueCapacity)]; }
+        const Event& front() const noexcept { return events[(size_t) head]; }
+
+        bool insert(juce::int64 due, const juce::uint8* bytes) noexcept
+        {
+            if (count == queueCapacity)
+                return false;
+
+            // Events almost always arrive in due order, so this rarely moves anything.
+            int pos = count;
+            while (pos > 0 && at(pos - 1).due > due)
+            {
+                at(pos) = at(pos - 1);
+                --pos;
+            }
+
+            auto& e = at(pos);
+            e.due = due;
+            e.bytes[0] = bytes[0];
+            e.bytes[1] = bytes[1];
+            e.bytes[2] = bytes[2];
+            ++count;
+            return true;
+        }
+
+        void popFront() noexcept
+        {
+            head = (head + 1) % queueCapacity;
+            --count;
+        }
+    };
+
+    std::array<Queue, numTracks> queues;
+
+    // Delay (samples) given to the sounding note-on of each (track, note), applied to its note-off.
+    std::array<int, numTracks * 128> noteDelay {};
+
+    std::array<int, numTracks> swingDelay {};
+
+    juce::int64 samplesProcessed { 0 };
+    double blockPpq { 0.0 };
+    double samplesPerQuarter { 1.0 };
+    bool playing { false };
+    bool wasPlaying { false };
+    bool flushAll { false };
+
+    Stats stats;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SwingEngine)
+};
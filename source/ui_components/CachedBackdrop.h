@@ -0,0 +1,69 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <array>
+#include <cmath>
+
+// A component's static background (gradient plates, rounded outlines, decor artwork) rendered
+// once into an image at the context's physical pixel scale and blitted on every later paint.
+// The image is re-rendered only when the area's size or the display scale changes, or after
+// invalidate() (call it from setters that change what the backdrop looks like), so repaints
+// triggered by value changes elsewhere don't redraw it.
+//
+// Up to numVariants looks can be held at once (e.g. normal / pressed); each is rendered the first
+// time it is drawn at the current size and scale.
+class CachedBackdrop final
+{
+public:
+    static constexpr int numVariants = 2;
+
+    CachedBackdrop() = default;
+
+    void invalidate() noexcept
+    {
+        for (auto& image : images)
+            image = {};
+    }
+
+    // Message thread. Draws `area`, calling paintBackdrop(Graphics&, Rectangle<float>) to render
+    // it first if needed; the rectangle it gets is `area` moved to the origin.
+    template <typename PaintFunction>
+    void draw(juce::Graphics& g, juce::Rectangle<float> area, PaintFunction&& paintBackdrop, int variant = 0)
+    {
+        if (area.isEmpty())
+            return;
+
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (area.getWidth() != width || area.getHeight() != height || scale != pixelScale)
+        {
+            invalidate();
+            width = area.getWidth();
+            height = area.getHeight();
+            pixelScale = scale;
+        }
+
+        auto& image = images[(size_t) juce::jlimit(0, numVariants - 1, variant)];
+        if (image.isNull())
+        {
+            const int w = juce::jmax(1, (int) std::ceil(width * pixelScale));
+            const int h = juce::jmax(1, (int) std::ceil(height * pixelScale));
+
+            image = juce::Image(juce::Image::ARGB, w, h, true);
+            juce::Graphics ig (image);
+            ig.addTransform(juce::AffineTransform::scale((float) w / width, (float) h / height));
+            paintBackdrop(ig, area.withZeroOrigin());
+        }
+
+        g.setOpacity(1.0f);
+        g.drawImage(image, area);
+    }
+
+private:
+    std::array<juce::Image, numVariants> images;
+    float width { 0.0f };
+    float height { 0.0f };
+    float pixelScale { 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CachedBackdrop)
+};
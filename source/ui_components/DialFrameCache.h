@@ -0,0 +1,330 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "RotaryDial.h"
+#include "StudioStyle.h"
+
+// Pre-rendered RotaryDialSlider artwork, shared by every editor (hold it in a
+// juce::SharedResourcePointer). Dials with the same style, size and display scale share one entry:
+//
+//   frames   background ring + value indicator, one image per quantized position (rendered lazily)
+//   overlay  min/max range text + knob image
+//
+// so repainting a dial is two image blits plus its value text. Entries are keyed by everything
+// that changes the pixels; a new size, scale, colour or image simply produces a new entry. The
+// whole cache is dropped once it grows past maxBytes.
+class DialFrameCache final
+{
+public:
+    // Value positions per entry: 0..128, so the bipolar centre (0.5) has an exact frame.
+    static constexpr int numFrames = 129;
+    static constexpr size_t maxBytes = (size_t) 48 * 1024 * 1024;
+
+    DialFrameCache() = default;
+
+    // Dial layout in slider-local coordinates (same maths as RotaryDialSlider::hitTest).
+    struct Geometry
+    {
+        juce::Rectangle<float> squareArea;
+        juce::Rectangle<float> ringBounds;
+        juce::Point<float> centre;
+        float radius { 0.0f };
+        float ringThickness { 0.0f };
+        float startAngle { 0.0f };
+        float endAngle { 0.0f };
+        float midAngle { 0.0f };
+        float spanRad { 0.0f };
+        float uiScale { 1.0f };
+    };
+
+    // `uiScale` is the editor scale (UiScale::of the dial): the dial's pixel constants are in
+    // design pixels.
+    static Geometry layout(const RotaryDialSlider& dial, juce::Rectangle<float> bounds, float uiScale = 1.0f)
+    {
+        Geometry geo;
+        geo.uiScale = uiScale;
+
+        const auto area = bounds.reduced(2.0f * uiScale);
+        const auto side = juce::jmin(area.getWidth(), area.getHeight());
+        geo.squareArea = area.withSizeKeepingCentre(side, side);
+
+        auto ringArea = geo.squareArea.withSizeKeepingCentre(side * dial.ringScale, side * dial.ringScale);
+        ringArea = ringArea.expanded(dial.ringOutsetPx * uiScale).getIntersection(geo.squareArea);
+        ringArea = ringArea.reduced(StudioStyle::Sizes::dialArcRadiusTrimPx * uiScale);
+
+        // Path::addCentredArc: 0 at 12 o'clock, increasing clockwise.
+        geo.spanRad = juce::degreesToRadians(dial.ringSpanDegrees);
+        geo.midAngle = juce::degreesToRadians(dial.ringRotationDegrees);
+        geo.startAngle = geo.midAngle - geo.spanRad * 0.5f;
+        geo.endAngle = geo.startAngle + geo.spanRad;
+
+        geo.centre = ringArea.getCentre();
+        geo.radius = ringArea.getWidth() * 0.5f;
+        geo.ringThickness = juce::jmin(dial.ringThicknessPx * uiScale, geo.radius - 2.0f);
+        geo.ringBounds = ringArea.reduced(geo.ringThickness * 0.5f);
+        return geo;
+    }
+
+    // Message thread. Blits the ring/value frame and the overlay for `bounds` (the rectangle
+    // drawRotarySlider was given) at the context's physical pixel scale.
+    void draw(juce::Graphics& g,
+              RotaryDialSlider& dial,
+              juce::Rectangle<int> bounds,
+              float sliderPosProportional,
+              juce::Colour valueColour,
+              const juce::Font& rangeFont)
+    {
+        if (bounds.isEmpty())
+            return;
+
+        if (totalBytes > maxBytes)
+        {
+            entries.clear();
+            totalBytes = 0;
+        }
+
+        Key key;
+        key.width = bounds.getWidth();
+        key.height = bounds.getHeight();
+        key.scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        key.uiScale = UiScale::of(dial);
+        key.mode = (int) dial.mode;
+        key.rangeDisplay = (int) dial.rangeDisplay;
+        key.ringSpanDegrees = dial.ringSpanDegrees;
+        key.ringScale = dial.ringScale;
+        key.ringOutsetPx = dial.ringOutsetPx;
+        key.ringRotationDegrees = dial.ringRotationDegrees;
+        key.ringThicknessPx = dial.ringThicknessPx;
+        key.dialImagePaddingPx = dial.dialImagePaddingPx;
+        key.dialImageOffsetPx = dial.dialImageOffsetPx;
+        key.valueArgb = valueColour.getARGB();
+        key.dialImage = dial.dialImage;
+
+        if (dial.rangeDisplay == RotaryDialSlider::RangeDisplay::MinMax)
+        {
+            key.minText = valueText(dial, dial.getMinimum());
+            key.maxText = valueText(dial, dial.getMaximum());
+        }
+
+        auto& entry = entries[key];
+        if (entry.frames.empty())
+            entry.frames.resize((size_t) numFrames);
+
+        const auto local = juce::Rectangle<float>(0.0f, 0.0f, (float) key.width, (float) key.height);
+        const auto geo = layout(dial, local, key.uiScale);
+        const auto target = bounds.toFloat();
+
+        const int frame = juce::jlimit(0, numFrames - 1, juce::roundToInt(sliderPosProportional * (float) (numFrames - 1)));
+        auto& frameImage = entry.frames[(size_t) frame];
+        if (! frameImage.isValid())
+        {
+            const float pos = (float) frame / (float) (numFrames - 1);
+            frameImage = render(key, [&] (juce::Graphics& fg)
+            {
+                paintRing(fg, geo);
+                paintValue(fg, geo, dial.mode, pos, valueColour);
+            });
+        }
+
+        if (! entry.overlayRendered)
+        {
+            entry.overlayRendered = true;
+            if (dial.rangeDisplay == RotaryDialSlider::RangeDisplay::MinMax || dial.dialImage.isValid())
+                entry.overlay = render(key, [&] (juce::Graphics& og)
+                {
+                    if (dial.rangeDisplay == RotaryDialSlider::RangeDisplay::MinMax)
+                        paintRangeText(og, geo, key.minText, key.maxText, rangeFont);
+
+                    paintDialImage(og, geo, dial);
+                });
+        }
+
+        g.setOpacity(1.0f);
+        g.drawImage(frameImage, target);
+
+        if (entry.overlay.isValid())
+            g.drawImage(entry.overlay, target);
+    }
+
+private:
+    struct Key
+    {
+        int width { 0 };
+        int height { 0 };
+        float scale { 1.0f };
+        float uiScale { 1.0f };
+        int mode { 0 };
+        int rangeDisplay { 0 };
+        float ringSpanDegrees { 0.0f };
+        float ringScale { 0.0f };
+        float ringOutsetPx { 0.0f };
+        float ringRotationDegrees { 0.0f };
+        float ringThicknessPx { 0.0f };
+        float dialImagePaddingPx { 0.0f };
+        float dialImageOffsetPx { 0.0f };
+        juce::uint32 valueArgb { 0 };
+        juce::Image dialImage; // compared by pixel data, and keeps it alive while the entry exists
+        juce::String minText;
+        juce::String maxText;
+
+        bool operator==(const Key& o) const
+        {
+            return width == o.width && height == o.height && scale == o.scale && uiScale == o.uiScale && mode == o.mode
+                && rangeDisplay == o.rangeDisplay && ringSpanDegrees == o.ringSpanDegrees
+                && ringScale == o.ringScale && ringOutsetPx == o.ringOutsetPx
+                && ringRotationDegrees == o.ringRotationDegrees && ringThicknessPx == o.ringThicknessPx
+                && dialImagePaddingPx == o.dialImagePaddingPx && dialImageOffsetPx == o.dialImageOffsetPx
+                && valueArgb == o.valueArgb && dialImage == o.dialImage
+                && minText == o.minText && maxText == o.maxText;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& k) const noexcept
+        {
+            size_t h = 0;
+            const auto mix = [&h] (size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+
+            mix((size_t) k.width);
+            mix((size_t) k.height);
+            mix(std::hash<float>()(k.scale));
+            mix(std::hash<float>()(k.uiScale));
+            mix((size_t) k.mode);
+            mix(std::hash<float>()(k.ringSpanDegrees));
+            mix(std::hash<float>()(k.ringScale));
+            mix(std::hash<float>()(k.ringThicknessPx));
+            mix((size_t) k.valueArgb);
+            mix(std::hash<const void*>()(k.dialImage.getPixelData()));
+            mix((size_t) k.minText.hash());
+            mix((size_t) k.maxText.hash());
+            return h;
+        }
+    };
+
+    struct Entry
+    {
+        std::vector<juce::Image> frames;
+        juce::Image overlay;
+        bool overlayRendered { false };
+    };
+
+    template <typename PaintFn>
+    juce::Image render(const Key& key, PaintFn&& paint)
+    {
+        const int w = juce::jmax(1, (int) std::ceil((float) key.width * key.scale));
+        const int h = juce::jmax(1, (int) std::ceil((float) key.height * key.scale));
+
+        juce::Image image (juce::Image::ARGB, w, h, true);
+        {
+            juce::Graphics ig (image);
+            ig.addTransform(juce::AffineTransform::scale((float) w / (float) key.width, (float) h / (float) key.height));
+            paint(ig);
+        }
+
+        totalBytes += (size_t) w * (size_t) h * 4;
+        return image;
+    }
+
+    static juce::String valueText(RotaryDialSlider& dial, double value)
+    {
+        if (const auto* text = dial.valueTexts.find(dial, value))
+            return *text;
+
+        return dial.getTextFromValue(value);
+    }
+
+    static float toCosSinAngle(float arcAngle)
+    {
+        // Convert arc angle (0 at 12) -> cos/sin angle (0 at 3)
+        return arcAngle - juce::MathConstants<float>::halfPi;
+    }
+
+    static void strokeArc(juce::Graphics& g, const Geometry& geo, float fromAngle, float toAngle)
+    {
+        juce::Path arc;
+        arc.addCentredArc(geo.centre.x, geo.centre.y,
+                          geo.ringBounds.getWidth() * 0.5f,
+                          geo.ringBounds.getHeight() * 0.5f,
+                          0.0f, fromAngle, toAngle, true);
+        g.strokePath(arc, juce::PathStrokeType(geo.ringThickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+    }
+
+    static void paintRing(juce::Graphics& g, const Geometry& geo)
+    {
+        g.setColour(juce::Colour(0xFF727676));
+        strokeArc(g, geo, geo.startAngle, geo.endAngle);
+    }
+
+    static void paintValue(juce::Graphics& g, const Geometry& geo, RotaryDialSlider::DialMode mode, float pos, juce::Colour colour)
+    {
+        g.setColour(colour);
+        const float valueAngle = geo.startAngle + pos * geo.spanRad;
+
+        if (mode == RotaryDialSlider::DialMode::UnipolarRing)
+        {
+            strokeArc(g, geo, geo.startAngle, valueAngle);
+        }
+        else if (mode == RotaryDialSlider::DialMode::BipolarRing)
+        {
+            strokeArc(g, geo, juce::jmin(geo.midAngle, valueAngle), juce::jmax(geo.midAngle, valueAngle));
+        }
+        else if (mode == RotaryDialSlider::DialMode::Needle)
+        {
+            const auto vp = toCosSinAngle(valueAngle);
+            const float needleLen = geo.radius * 0.42f;
+            const float needleStart = geo.radius * 0.16f;
+
+            const auto p0 = geo.centre + juce::Point<float>(std::cos(vp), std::sin(vp)) * needleStart;
+            const auto p1 = geo.centre + juce::Point<float>(std::cos(vp), std::sin(vp)) * (needleStart + needleLen);
+            g.drawLine({ p0.x, p0.y, p1.x, p1.y }, 2.0f * geo.uiScale);
+        }
+    }
+
+    static void paintRangeText(juce::Graphics& g, const Geometry& geo, const juce::String& minText,
+                               const juce::String& maxText, const juce::Font& font)
+    {
+        const auto textRadius = geo.radius - geo.ringThickness - 10.0f * geo.uiScale;
+        const auto startP = toCosSinAngle(geo.startAngle);
+        const auto endP = toCosSinAngle(geo.endAngle);
+        const auto minPos = geo.centre + juce::Point<float>(std::cos(startP), std::sin(startP)) * textRadius;
+        const auto maxPos = geo.centre + juce::Point<float>(std::cos(endP), std::sin(endP)) * textRadius;
+
+        g.setColour(StudioStyle::Colours::foreground.withAlpha(0.75f));
+        g.setFont(font);
+
+        const auto textBox = juce::Rectangle<float>(0.0f, 0.0f, 48.0f, 16.0f) * geo.uiScale;
+        const auto rMin = textBox.withCentre(minPos);
+        const auto rMax = textBox.withCentre(maxPos);
+        g.drawFittedText(minText, rMin.toNearestInt(), juce::Justification::centred, 1);
+        g.drawFittedText(maxText, rMax.toNearestInt(), juce::Justification::centred, 1);
+    }
+
+    static void paintDialImage(juce::Graphics& g, const Geometry& geo, const RotaryDialSlider& dial)
+    {
+        if (! dial.dialImage.isValid())
+            return;
+
+        auto imageBounds = geo.squareArea.reduced(geo.ringThickness + dial.dialImagePaddingPx * geo.uiScale);
+        imageBounds = imageBounds.translated(dial.dialImageOffsetPx * geo.uiScale, dial.dialImageOffsetPx * geo.uiScale);
+
+        g.setOpacity(1.0f);
+        g.drawImageWithin(dial.dialImage,
+                          (int) imageBounds.getX(),
+                          (int) imageBounds.getY(),
+                          (int) imageBounds.getWidth(),
+                          (int) imageBounds.getHeight(),
+                          juce::RectanglePlacement::centred);
+    }
+
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    size_t totalBytes { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DialFrameCache)
+};
@@ -2,7 +2,10 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "CachedBackdrop.h"
 #include "StudioStyle.h"
+#include "SvgArtworkCache.h"
+#include "UiScale.h"
 
 class ImageToggle final : public juce::ToggleButton
 {
@@ -12,6 +15,7 @@ public:
     void setCornerRadius(float newRadiusPx)
     {
         cornerRadiusPx = juce::jmax(0.0f, newRadiusPx);
+        backdrop.invalidate();
         repaint();
     }
 
@@ -25,13 +29,14 @@ public:
     {
         lightGrey = newLight;
         darkGrey = newDark;
+        backdrop.invalidate();
         repaint();
     }
 
     void setImagesFromMemory(const void* offData, int offBytes, const void* onData, int onBytes)
     {
-        offDrawable = createDrawableFromData(offData, offBytes);
-        onDrawable = createDrawableFromData(onData, onBytes);
+        offArtwork = { offData, offBytes };
+        onArtwork = { onData, onBytes };
         repaint();
     }
 
@@ -39,13 +44,35 @@ public:
     {
         juce::ignoreUnused(isMouseOverButton, isButtonDown);
         const auto outer = getLocalBounds().toFloat();
+        const float uiScale = UiScale::of(*this);
+
+        // A-C don't depend on the toggle state, so they come from the backdrop cache.
+        backdrop.draw(g, outer, [this, uiScale] (juce::Graphics& bg, juce::Rectangle<float> area) { paintBackdrop(bg, area, uiScale); });
+
+        // D: icon (~0.6 of inner)
+        const auto artwork = getToggleState() ? onArtwork : offArtwork;
+        if (artwork.isValid())
+        {
+            const auto b = outer.reduced(StudioStyle::Sizes::buttonOutlinePx * uiScale);
+            const auto side = juce::jmin(b.getWidth(), b.getHeight());
+            auto imageBounds = b.withSizeKeepingCentre(side * StudioStyle::Sizes::buttonIconScale,
+                                                       side * StudioStyle::Sizes::buttonIconScale);
+            artworkCache->draw(g, artwork, imageBounds);
+        }
+    }
+
+private:
+    void paintBackdrop(juce::Graphics& g, juce::Rectangle<float> outer, float uiScale) const
+    {
+        const float cornerPx = cornerRadiusPx * uiScale;
+        const float outlinePx = StudioStyle::Sizes::buttonOutlinePx * uiScale;
 
         // A: black rounded-rect background (full size)
         g.setColour(StudioStyle::Colours::buttonOutline);
-        g.fillRoundedRectangle(outer, cornerRadiusPx);
+        g.fillRoundedRectangle(outer, cornerPx);
 
         // B: inner gradient rounded-rect (inset by outlinePx)
-        auto b = outer.reduced(StudioStyle::Sizes::buttonOutlinePx);
+        auto b = outer.reduced(outlinePx);
 
         const auto light = lightGrey.brighter(0.5f);
 
@@ -57,34 +84,16 @@ public:
         grad.addColour(1.00, darkGrey);
 
         g.setGradientFill(grad);
-        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerRadiusPx - StudioStyle::Sizes::buttonOutlinePx));
+        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerPx - outlinePx));
 
         // C: midGrey plate (~0.7 of inner)
         const auto side = juce::jmin(b.getWidth(), b.getHeight());
         auto plateBounds = b.withSizeKeepingCentre(side * StudioStyle::Sizes::buttonPlateScale,
                                                    side * StudioStyle::Sizes::buttonPlateScale);
 
-        const float plateCorner = juce::jmin(cornerRadiusPx * 0.44f, plateBounds.getHeight() * 0.22f);
+        const float plateCorner = juce::jmin(cornerPx * 0.44f, plateBounds.getHeight() * 0.22f);
         g.setColour(midGrey);
         g.fillRoundedRectangle(plateBounds, plateCorner);
-
-        // D: icon (~0.6 of inner)
-        auto* drawable = getToggleState() ? onDrawable.get() : offDrawable.get();
-        if (drawable != nullptr)
-        {
-            auto imageBounds = b.withSizeKeepingCentre(side * StudioStyle::Sizes::buttonIconScale,
-                                                       side * StudioStyle::Sizes::buttonIconScale);
-            drawable->drawWithin(g, imageBounds, juce::RectanglePlacement::centred, 1.0f);
-        }
-    }
-
-private:
-    static std::unique_ptr<juce::Drawable> createDrawableFromData(const void* data, int bytes)
-    {
-        if (data == nullptr || bytes <= 0)
-            return {};
-
-        return juce::Drawable::createFromImageData(data, (size_t) bytes);
     }
 
     float cornerRadiusPx { StudioStyle::Sizes::buttonCornerRadiusPx };
@@ -94,8 +103,10 @@ private:
     juce::Colour darkGrey  { StudioStyle::Colours::buttonDark };
     juce::Colour midGrey   { StudioStyle::Colours::buttonPlate };
 
-    std::unique_ptr<juce::Drawable> offDrawable;
-    std::unique_ptr<juce::Drawable> onDrawable;
+    CachedBackdrop backdrop;
+    juce::SharedResourcePointer<SvgArtworkCache> artworkCache;
+    SvgArtworkCache::Asset offArtwork;
+    SvgArtworkCache::Asset onArtwork;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ImageToggle)
 };
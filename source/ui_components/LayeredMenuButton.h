@@ -3,6 +3,8 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 
 #include "StudioStyle.h"
+#include "SvgArtworkCache.h"
+#include "UiScale.h"
 
 class LayeredMenuButton final : public juce::Component
 {
@@ -54,14 +56,14 @@ public:
 
     void setImagesFromMemory(const void* baseData, int baseBytes)
     {
-        baseDrawable = createDrawableFromData(baseData, baseBytes);
+        baseArtwork = { baseData, baseBytes };
         repaint();
     }
 
     void clearItems()
     {
         combo.clear(juce::dontSendNotification);
-        overlayDrawables.clear();
+        overlayArtwork.clear();
         selectedIndex = 0;
         repaint();
     }
@@ -69,10 +71,10 @@ public:
     void addItem(int itemId, juce::String text, const void* overlayData, int overlayBytes)
     {
         combo.addItem(text, itemId);
-        overlayDrawables.emplace_back(createDrawableFromData(overlayData, overlayBytes));
+        overlayArtwork.push_back({ overlayData, overlayBytes });
 
         // Also show the overlay SVG in the ComboBox popup menu next to the item.
-        if (auto* d = overlayDrawables.back().get())
+        if (auto* d = artworkCache->getDrawable(overlayArtwork.back()))
         {
             if (auto* menu = combo.getRootMenu())
             {
@@ -102,13 +104,16 @@ public:
     void paint(juce::Graphics& g) override
     {
         const auto outer = getLocalBounds().toFloat();
+        const float uiScale = UiScale::of(*this);
+        const float cornerPx = cornerRadiusPx * uiScale;
+        const float outlinePx = StudioStyle::Sizes::buttonOutlinePx * uiScale;
 
         // A: black rounded-rect background (full size)
         g.setColour(StudioStyle::Colours::buttonOutline);
-        g.fillRoundedRectangle(outer, cornerRadiusPx);
+        g.fillRoundedRectangle(outer, cornerPx);
 
         // B: inner gradient rounded-rect (inset by outlinePx)
-        auto b = outer.reduced(StudioStyle::Sizes::buttonOutlinePx);
+        auto b = outer.reduced(outlinePx);
 
 
         const auto light = lightGrey.brighter(0.5f);
@@ -119,7 +124,7 @@ public:
         grad.addColour(1.00, darkGrey);
 
         g.setGradientFill(grad);
-        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerRadiusPx - StudioStyle::Sizes::buttonOutlinePx));
+        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerPx - outlinePx));
 
         const auto side = juce::jmin(b.getWidth(), b.getHeight());
 
@@ -127,29 +132,23 @@ public:
         auto plateBounds = b.withSizeKeepingCentre(side * StudioStyle::Sizes::buttonPlateScale,
                                                    side * StudioStyle::Sizes::buttonPlateScale);
 
-        const float plateCorner = juce::jmin(cornerRadiusPx * 0.45f, plateBounds.getHeight() * 0.12f);
+        const float plateCorner = juce::jmin(cornerPx * 0.45f, plateBounds.getHeight() * 0.12f);
         g.setColour(midGrey);
         g.fillRoundedRectangle(plateBounds, plateCorner);
 
         // D: base icon (~0.6 of inner)
-        if (baseDrawable != nullptr)
+        if (baseArtwork.isValid())
         {
             auto baseBounds = b.withSizeKeepingCentre(side * StudioStyle::Sizes::buttonIconScale,
                                                       side * StudioStyle::Sizes::buttonIconScale);
-            baseDrawable->drawWithin(g, baseBounds, juce::RectanglePlacement::centred, 1.0f);
+            artworkCache->draw(g, baseArtwork, baseBounds);
 
-            if (selectedIndex >= 0 && selectedIndex < (int) overlayDrawables.size())
+            if (selectedIndex >= 0 && selectedIndex < (int) overlayArtwork.size())
             {
-                if (auto* overlay = overlayDrawables[(size_t) selectedIndex].get())
-                {
-                    auto overlayBounds = baseBounds.withSizeKeepingCentre(baseBounds.getWidth() * StudioStyle::Sizes::buttonOverlayScale,
-                                                                          baseBounds.getHeight() * StudioStyle::Sizes::buttonOverlayScale);
+                auto overlayBounds = baseBounds.withSizeKeepingCentre(baseBounds.getWidth() * StudioStyle::Sizes::buttonOverlayScale,
+                                                                      baseBounds.getHeight() * StudioStyle::Sizes::buttonOverlayScale);
 
-                    if (auto recoloured = recolourDrawableForButton(overlay, juce::Colours::white))
-                        recoloured->drawWithin(g, overlayBounds, juce::RectanglePlacement::centred, 1.0f);
-                    else
-                        overlay->drawWithin(g, overlayBounds, juce::RectanglePlacement::centred, 1.0f);
-                }
+                artworkCache->draw(g, overlayArtwork[(size_t) selectedIndex], overlayBounds, juce::Colours::white);
             }
         }
     }
@@ -166,32 +165,9 @@ public:
     }
 
 private:
-    static std::unique_ptr<juce::Drawable> createDrawableFromData(const void* data, int bytes)
-    {
-        if (data == nullptr || bytes <= 0)
-            return {};
-
-        return juce::Drawable::createFromImageData(data, (size_t) bytes);
-    }
-
-    static std::unique_ptr<juce::Drawable> recolourDrawableForButton(const juce::Drawable* source, juce::Colour target)
-    {
-        if (source == nullptr)
-            return {};
-
-        auto copy = source->createCopy();
-        if (copy == nullptr)
-            return {};
-
-        // The shipped SVGs are monochrome; replace common "foreground" colours.
-        copy->replaceColour(juce::Colours::black, target);
-        copy->replaceColour(juce::Colour(0xFF021616), target);
-        return copy;
-    }
-
     juce::ComboBox combo;
 
-    struct PopupLookAndFeel final : public juce::LookAndFeel_V4
+    struct PopupLookAndFeel final : public PopupScaledLookAndFeel
     {
         static std::unique_ptr<juce::Drawable> recolourIconForMenu(const juce::Drawable* source, juce::Colour target)
         {
@@ -214,6 +190,11 @@ private:
             g.fillAll(juce::Colour(0xFFCEE5E8));
         }
 
+        juce::Font getPopupMenuFont() override
+        {
+            return StudioStyle::Fonts::alphaSmartPlain((StudioStyle::Fonts::SizePx::alphaComboMenu - 2.0f) * popupScale);
+        }
+
         void getIdealPopupMenuItemSize(const juce::String& text, bool isSeparator, int standardMenuItemHeight,
                                        int& idealWidth, int& idealHeight) override
         {
@@ -222,19 +203,15 @@ private:
             if (isSeparator)
                 return;
 
-            auto f = StudioStyle::Fonts::alphaComboMenuFont();
-            f.setHeight(juce::jmax(10.0f, f.getHeight() - 2.0f));
+            const auto f = getPopupMenuFont();
 
-            const int iconSide = 20;
+            const int iconSide = popupPx(20);
             juce::GlyphArrangement ga;
             ga.addLineOfText(f, text, 0.0f, 0.0f);
             const int textW = juce::roundToInt(ga.getBoundingBox(0, -1, true).getWidth());
 
             // Tighten menu width: icon + gap + text + margins.
-            constexpr int minW = 96;
-            constexpr int maxW = 150;
-            constexpr int padW = 36;
-            idealWidth = juce::jlimit(minW, maxW, iconSide + 8 + textW + padW);
+            idealWidth = juce::jlimit(popupPx(96), popupPx(150), iconSide + popupPx(8) + textW + popupPx(36));
         }
 
         void drawPopupMenuItem(juce::Graphics& g, const juce::Rectangle<int>& area,
@@ -256,20 +233,20 @@ private:
                 return;
             }
 
-            auto r = area.reduced(4);
+            auto r = area.reduced(popupPx(4));
 
             if (isTicked)
             {
                 g.setColour(selectedBg);
-                g.fillRoundedRectangle(r.toFloat(), 4.0f);
+                g.fillRoundedRectangle(r.toFloat(), 4.0f * popupScale);
             }
             else if (isHighlighted)
             {
                 g.setColour(normalFg.withAlpha(0.10f));
-                g.fillRoundedRectangle(r.toFloat(), 4.0f);
+                g.fillRoundedRectangle(r.toFloat(), 4.0f * popupScale);
             }
 
-            const int iconSide = 20;
+            const int iconSide = popupPx(20);
             const int iconX = r.getX();
             const int iconY = r.getCentreY() - iconSide / 2;
 
@@ -284,13 +261,9 @@ private:
                     icon->drawWithin(g, iconBounds, juce::RectanglePlacement::centred, 1.0f);
             }
 
-            auto textArea = r.withTrimmedLeft(iconSide + 8);
+            auto textArea = r.withTrimmedLeft(iconSide + popupPx(8));
             g.setColour(isTicked ? selectedFg : normalFg);
-            {
-                auto f = StudioStyle::Fonts::alphaComboMenuFont();
-                f.setHeight(juce::jmax(10.0f, f.getHeight() - 2.0f));
-                g.setFont(f);
-            }
+            g.setFont(getPopupMenuFont());
             g.drawFittedText(text, textArea, juce::Justification::centredLeft, 1);
         }
     };
@@ -304,8 +277,9 @@ private:
     juce::Colour darkGrey  { StudioStyle::Colours::buttonDark };
     juce::Colour midGrey   { StudioStyle::Colours::buttonPlate };
 
-    std::unique_ptr<juce::Drawable> baseDrawable;
-    std::vector<std::unique_ptr<juce::Drawable>> overlayDrawables;
+    juce::SharedResourcePointer<SvgArtworkCache> artworkCache;
+    SvgArtworkCache::Asset baseArtwork;
+    std::vector<SvgArtworkCache::Asset> overlayArtwork;
     int selectedIndex { 0 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LayeredMenuButton)
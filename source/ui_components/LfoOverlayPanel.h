@@ -3,6 +3,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 
 #include "OverlayDial.h"
+#include "UiScale.h"
 
 class LfoOverlayPanel final : public juce::Component
 {
@@ -130,16 +131,18 @@ public:
 
     void resized() override
     {
-        auto area = getLocalBounds().reduced(4);
-        constexpr int rowGapPx = 10;
+        // Sizes here are in design pixels; the editor scale maps them to the panel's real size.
+        const float editorScale = UiScale::of(*this);
+        auto area = getLocalBounds().reduced(juce::roundToInt(4.0f * editorScale));
+        const int rowGapPx = juce::roundToInt(10.0f * editorScale);
         const int rowH = juce::jmax(1, (area.getHeight() - rowGapPx) / 2);
 
         auto row1 = area.removeFromTop(rowH);
         area.removeFromTop(rowGapPx);
         auto row2 = area;
 
-        layoutRow(row1, multiplyDial, waveformLabel, waveformComboBackdrop, waveformCombo, phaseDial);
-        layoutRow(row2, depthDial, destinationLabel, destinationComboBackdrop, destinationCombo, fadeDial);
+        layoutRow(row1, multiplyDial, waveformLabel, waveformComboBackdrop, waveformCombo, phaseDial, editorScale);
+        layoutRow(row2, depthDial, destinationLabel, destinationComboBackdrop, destinationCombo, fadeDial, editorScale);
     }
 
     void paint(juce::Graphics& g) override
@@ -154,7 +157,9 @@ private:
         void paint(juce::Graphics& g) override
         {
             auto bounds = getLocalBounds().toFloat();
-            const float r = 6.0f;
+            const float uiScale = UiScale::of(*this);
+            const float r = 6.0f * uiScale;
+            const float insetPx = 3.0f * uiScale;
 
             // Match the pattern selector style: gradient outer band + solid inner fill.
             const auto light = StudioStyle::Colours::canvas.brighter(0.5f);
@@ -162,8 +167,8 @@ private:
 
                         // Diagonal blend band: shift the left side down (+10) and the right side up (-20)
             // so the transition sits towards the lower-left and upper-right corners.
-            const auto darkPoint  = bounds.getTopLeft().translated(30.0f, -5.0f);
-            const auto lightPoint = bounds.getBottomRight().translated(-60.0f,  -5.0f);
+            const auto darkPoint  = bounds.getTopLeft().translated(30.0f * uiScale, -5.0f * uiScale);
+            const auto lightPoint = bounds.getBottomRight().translated(-60.0f * uiScale, -5.0f * uiScale);
 
             //juce::ColourGradient grad(dark, bounds.getTopLeft(), light, bounds.getBottomRight(), false);
             juce::ColourGradient grad(dark, darkPoint, light, lightPoint, false);
@@ -176,25 +181,24 @@ private:
             g.setGradientFill(grad);
             g.fillRoundedRectangle(bounds, r);
 
-            auto inner = bounds.reduced(3.0f);
+            auto inner = bounds.reduced(insetPx);
             g.setColour(base);
-            g.fillRoundedRectangle(inner, juce::jmax(0.0f, r - 3.0f));
+            g.fillRoundedRectangle(inner, juce::jmax(0.0f, r - insetPx));
         }
 
         juce::Colour base { juce::Colour(0xFFCEE5E8) };
     };
 
-    struct ComboLookAndFeel final : public juce::LookAndFeel_V4
+    struct ComboLookAndFeel final : public PopupScaledLookAndFeel
     {
         juce::Font getComboBoxFont(juce::ComboBox& box) override
         {
-            juce::ignoreUnused(box);
-            return StudioStyle::Fonts::alphaComboTextFont();
+            return StudioStyle::Fonts::alphaSmartPlain(StudioStyle::Fonts::SizePx::alphaComboText * UiScale::of(box));
         }
 
         juce::Font getPopupMenuFont() override
         {
-            return StudioStyle::Fonts::alphaComboMenuFont();
+            return StudioStyle::Fonts::alphaSmartPlain(StudioStyle::Fonts::SizePx::alphaComboMenu * popupScale);
         }
 
         void getIdealPopupMenuItemSize(const juce::String& text, bool isSeparator, int standardMenuItemHeight,
@@ -211,10 +215,7 @@ private:
             const int textW = juce::roundToInt(ga.getBoundingBox(0, -1, true).getWidth());
 
             // Keep these menus compact (they were reading too wide).
-            constexpr int minW = 84;
-            constexpr int maxW = 170;
-            constexpr int padW = 44;
-            idealWidth = juce::jlimit(minW, maxW, textW + padW);
+            idealWidth = juce::jlimit(popupPx(84), popupPx(170), textW + popupPx(44));
         }
 
         void drawComboBox(juce::Graphics& g, int width, int height, bool,
@@ -228,7 +229,8 @@ private:
         {
             // Give the text more horizontal room (avoid squeezed-looking glyphs for long items
             // like "SAW-HLF") without changing the font size.
-            label.setBounds(box.getLocalBounds().reduced(0, 2).translated(0, 2));
+            const int insetPx = juce::roundToInt(2.0f * UiScale::of(box));
+            label.setBounds(box.getLocalBounds().reduced(0, insetPx).translated(0, insetPx));
             label.setFont(getComboBoxFont(box));
             label.setJustificationType(juce::Justification::centred);
             // Never horizontally scale the font to fit; prefer truncation if it ever overflows.
@@ -260,16 +262,16 @@ private:
             }
 
             // Make selection/highlight rows taller.
-            auto r = area.reduced(4, 0);
+            auto r = area.reduced(popupPx(4), 0);
             if (isTicked)
             {
                 g.setColour(selectedBg);
-                g.fillRoundedRectangle(r.toFloat(), 5.0f);
+                g.fillRoundedRectangle(r.toFloat(), 5.0f * popupScale);
             }
             else if (isHighlighted)
             {
                 g.setColour(textFg.withAlpha(0.12f));
-                g.fillRoundedRectangle(r.toFloat(), 5.0f);
+                g.fillRoundedRectangle(r.toFloat(), 5.0f * popupScale);
             }
 
             g.setColour(isTicked ? selectedFg : textFg);
@@ -314,8 +316,11 @@ private:
                   juce::Label& midLabel,
                   juce::Component& midComboBackdrop,
                   juce::ComboBox& midCombo,
-                  OverlayDial& rightDial)
+                  OverlayDial& rightDial,
+                  float editorScale)
     {
+        const auto px = [editorScale] (float designPx) { return juce::roundToInt(designPx * editorScale); };
+
         const int colW = row.getWidth() / 3;
         auto col1 = row.removeFromLeft(colW);
         auto col2 = row.removeFromLeft(colW);
@@ -325,10 +330,10 @@ private:
 
         // OverlayDial compensates internally so the visible arc is desiredDialArcSidePx.
         // Width needs to account for the LookAndFeel reductions (+10).
-        const int dialW = juce::jmax(20, desiredDialArcSidePx + 10);
-        const int dialLabelH = (int) juce::roundToInt(18.0f * miniDialUIScale);
-        const int dialGapH = (int) juce::roundToInt(4.0f * miniDialUIScale);
-        const int dialH = juce::jmax(24, dialW + dialGapH + dialLabelH);
+        const int dialW = juce::jmax(px(20), px(desiredDialArcSidePx + 10));
+        const int dialLabelH = px(18.0f * miniDialUIScale);
+        const int dialGapH = px(4.0f * miniDialUIScale);
+        const int dialH = juce::jmax(px(24), dialW + dialGapH + dialLabelH);
 
         const int dialCentreY = row.getCentreY();
 
@@ -340,19 +345,19 @@ private:
         rightDial.setBounds(juce::Rectangle<int>(0, 0, dialW, dialH).withCentre({ rightCentreX, dialCentreY }));
 
         // Combos: slightly larger/taller and much wider so long items (e.g. SAW-HALF) don't squeeze.
-        const int baseComboH = juce::jlimit(20, 34, (int) std::floor((float) rowH * 0.40f));
-        const int comboH = juce::jlimit(24, 46, (int) std::lround((float) baseComboH * 1.55f));
-        const int gap = 4;
+        const int baseComboH = juce::jlimit(px(20), px(34), (int) std::floor((float) rowH * 0.40f));
+        const int comboH = juce::jlimit(px(24), px(46), (int) std::lround((float) baseComboH * 1.55f));
+        const int gap = px(4);
 
-        auto mid = col2.reduced(4);
-        const int comboW = juce::jmax(40, mid.getWidth() - 14);
+        auto mid = col2.reduced(px(4));
+        const int comboW = juce::jmax(px(40), mid.getWidth() - px(14));
 
         // Align WAVEFORM/DESTINATION label with the dial labels (MULTIPLY/PHASE and DEPTH/FADE).
         // OverlayDial places its label in the bottom area and then translates it up slightly.
-        constexpr int dialLabelRaisePx = 11;
+        const int dialLabelRaisePx = px(11);
         const int dialLabelTop = leftDial.getY() + (dialH - dialLabelH) - dialLabelRaisePx;
 
-        constexpr int labelDownPx = 2;
+        const int labelDownPx = px(2);
 
         midLabel.setBounds(juce::Rectangle<int>(0, 0, comboW, dialLabelH)
                    .withCentre({ midCentreX, dialLabelTop + dialLabelH / 2 + labelDownPx }));
@@ -366,8 +371,8 @@ private:
         midComboBackdrop.setBounds(comboBounds);
         // Keep the backdrop frame, but allow the *text-only* ComboBox to be wider so long
         // selections (e.g. "SAW-HLF") don't ellipsize.
-        auto comboInner = comboBounds.reduced(3);
-        midCombo.setBounds(comboInner.expanded(10, 0));
+        auto comboInner = comboBounds.reduced(px(3));
+        midCombo.setBounds(comboInner.expanded(px(10), 0));
     }
 
     ComboLookAndFeel comboLookAndFeel;
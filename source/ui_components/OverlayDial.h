@@ -3,6 +3,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 
 #include "RotaryDial.h"
+#include "UiScale.h"
 
 // A compact dial component intended for overlays.
 // Key differences vs RotaryDial:
@@ -42,6 +43,13 @@ public:
     juce::Slider& getSlider() { return slider; }
     const juce::Slider& getSlider() const { return slider; }
 
+    // Call after replacing the slider's text functions (e.g. binding another parameter).
+    void invalidateValueText()
+    {
+        slider.valueTexts.invalidate();
+        slider.repaint();
+    }
+
     void setLabelText(juce::String newText)
     {
         label.setText(newText.toUpperCase(), juce::dontSendNotification);
@@ -127,8 +135,12 @@ public:
     {
         auto b = getLocalBounds();
 
-        const int labelH = (int) juce::roundToInt(StudioStyle::Sizes::overlayDialLabelAreaHeightPx * uiScale);
-        const int gap = (int) juce::roundToInt(StudioStyle::Sizes::overlayDialLabelGapPx * uiScale);
+        // uiScale and the pixel sizes here are in design pixels; the editor scale maps them to pixels.
+        const float editorScale = UiScale::of(*this);
+        const float scale = uiScale * editorScale;
+
+        const int labelH = (int) juce::roundToInt(StudioStyle::Sizes::overlayDialLabelAreaHeightPx * scale);
+        const int gap = (int) juce::roundToInt(StudioStyle::Sizes::overlayDialLabelGapPx * scale);
 
         auto labelArea = b.removeFromBottom(labelH);
         b.removeFromBottom(gap);
@@ -138,15 +150,15 @@ public:
         // - ringArea.reduced(trim=3) => -6 px
         // Total: -10 px.
         // So to get a visible arc box of ~arcSidePx, we allocate +10 px here.
-        const int sliderSide = arcSidePx + 10;
+        const int sliderSide = juce::roundToInt((float) (arcSidePx + 10) * editorScale);
 
         const int side = juce::jmin(sliderSide, b.getWidth(), b.getHeight());
         auto dialArea = b.withSizeKeepingCentre(side, side);
         slider.setBounds(dialArea);
 
         // Move label up a bit (overlay only), but keep slightly more distance to the dial.
-        label.setBounds(labelArea.translated(0, labelYOffsetPx));
-        label.setFont(StudioStyle::Fonts::overlayDialLabelFont());
+        label.setBounds(labelArea.translated(0, juce::roundToInt((float) labelYOffsetPx * editorScale)));
+        label.setFont(StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::overlayDialLabel * editorScale));
     }
 
 private:
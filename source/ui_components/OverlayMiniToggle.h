@@ -2,6 +2,9 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "SvgArtworkCache.h"
+#include "UiScale.h"
+
 class OverlayMiniToggle final : public juce::ToggleButton
 {
 public:
@@ -9,8 +12,8 @@ public:
 
     void setImagesFromMemory(const void* offData, int offBytes, const void* onData, int onBytes)
     {
-        offDrawable = createDrawableFromData(offData, offBytes);
-        onDrawable = createDrawableFromData(onData, onBytes);
+        offArtwork = { offData, offBytes };
+        onArtwork = { onData, onBytes };
         repaint();
     }
 
@@ -25,32 +28,26 @@ public:
         juce::ignoreUnused(isMouseOverButton, isButtonDown);
 
         const auto outer = getLocalBounds().toFloat();
+        const float uiScale = UiScale::of(*this);
 
         // Black rounded rectangle background.
         g.setColour(juce::Colours::black);
-        g.fillRoundedRectangle(outer, cornerRadiusPx);
+        g.fillRoundedRectangle(outer, cornerRadiusPx * uiScale);
 
         // Inset SVG artwork by 2px on all sides.
-        if (auto* drawable = getToggleState() ? onDrawable.get() : offDrawable.get())
+        if (const auto artwork = getToggleState() ? onArtwork : offArtwork; artwork.isValid())
         {
-            auto imageBounds = outer.reduced(2.0f);
-            drawable->drawWithin(g, imageBounds, juce::RectanglePlacement::centred, 1.0f);
+            auto imageBounds = outer.reduced(2.0f * uiScale);
+            artworkCache->draw(g, artwork, imageBounds);
         }
     }
 
 private:
-    static std::unique_ptr<juce::Drawable> createDrawableFromData(const void* data, int bytes)
-    {
-        if (data == nullptr || bytes <= 0)
-            return {};
-
-        return juce::Drawable::createFromImageData(data, (size_t) bytes);
-    }
-
     float cornerRadiusPx { 4.0f };
 
-    std::unique_ptr<juce::Drawable> offDrawable;
-    std::unique_ptr<juce::Drawable> onDrawable;
+    juce::SharedResourcePointer<SvgArtworkCache> artworkCache;
+    SvgArtworkCache::Asset offArtwork;
+    SvgArtworkCache::Asset onArtwork;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OverlayMiniToggle)
 };
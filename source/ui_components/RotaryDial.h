@@ -5,6 +5,8 @@
 #include <cmath>
 
 #include "StudioStyle.h"
+#include "UiScale.h"
+#include "ValueTextCache.h"
 
 class RotaryDialSlider final : public juce::Slider
 {
@@ -16,13 +18,14 @@ public:
 
     bool hitTest(int x, int y) override
     {
-        const auto area = getLocalBounds().toFloat().reduced(2.0f);
+        const float editorScale = UiScale::of(*this);
+        const auto area = getLocalBounds().toFloat().reduced(2.0f * editorScale);
         const auto side = juce::jmin(area.getWidth(), area.getHeight());
         const auto squareArea = area.withSizeKeepingCentre(side, side);
 
         auto ringArea = squareArea.withSizeKeepingCentre(side * ringScale, side * ringScale);
-        ringArea = ringArea.expanded(ringOutsetPx).getIntersection(squareArea);
-        ringArea = ringArea.reduced(StudioStyle::Sizes::dialArcRadiusTrimPx);
+        ringArea = ringArea.expanded(ringOutsetPx * editorScale).getIntersection(squareArea);
+        ringArea = ringArea.reduced(StudioStyle::Sizes::dialArcRadiusTrimPx * editorScale);
 
         const auto centre = ringArea.getCentre();
         const float radius = ringArea.getWidth() * 0.5f;
@@ -71,6 +74,9 @@ public:
     // Optional pixel offset for centering dial artwork.
     float dialImageOffsetPx { StudioStyle::Sizes::dialImageOffsetPx };
 
+    // Value text per value position, for the centre text and the min/max range text.
+    ValueTextTable valueTexts;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RotaryDialSlider)
 };
 
@@ -120,6 +126,13 @@ public:
     juce::Slider& getSlider() { return slider; }
     const juce::Slider& getSlider() const { return slider; }
 
+    // Call after replacing the slider's text functions (e.g. binding another parameter).
+    void invalidateValueText()
+    {
+        slider.valueTexts.invalidate();
+        slider.repaint();
+    }
+
     void setDialMode(DialMode newMode)
     {
         slider.mode = static_cast<RotaryDialSlider::DialMode>(newMode);
@@ -269,15 +282,20 @@ public:
     {
         auto bounds = getLocalBounds();
 
-        constexpr int labelYOffsetPx = StudioStyle::Sizes::dialLabelYOffsetPx;
+        // uiScale is the dial's size in the 750x500 design; the editor scale maps that to pixels.
+        const float editorScale = UiScale::of(*this);
+        const float scale = uiScale * editorScale;
+        const int labelYOffsetPx = juce::roundToInt((float) StudioStyle::Sizes::dialLabelYOffsetPx * editorScale);
+        const int sliderInsetPx = juce::roundToInt(2.0f * editorScale);
+        const auto labelFont = StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::dialLabel * editorScale);
 
         const int labelHeight = (labelPlacement == LabelPlacement::None)
                         ? 0
-                        : (int) juce::roundToInt(StudioStyle::Sizes::dialLabelAreaHeightPx * uiScale);
+                        : (int) juce::roundToInt(StudioStyle::Sizes::dialLabelAreaHeightPx * scale);
         const int gap = (labelPlacement == LabelPlacement::None)
                     ? 0
-                    : (int) juce::roundToInt(StudioStyle::Sizes::dialLabelGapPx * uiScale);
-        const int labelRaisePx = (int) juce::roundToInt(labelRaiseBasePx * uiScale);
+                    : (int) juce::roundToInt(StudioStyle::Sizes::dialLabelGapPx * scale);
+        const int labelRaisePx = (int) juce::roundToInt(labelRaiseBasePx * scale);
 
         if (labelPlacement == LabelPlacement::Above)
         {
@@ -285,11 +303,11 @@ public:
             bounds.removeFromTop(gap);
             label.setBounds(labelArea.translated(0, labelYOffsetPx));
 
-            label.setFont(StudioStyle::Fonts::dialLabelFont());
+            label.setFont(labelFont);
 
             const int side = juce::jmin(bounds.getWidth(), bounds.getHeight());
             auto dialArea = bounds.removeFromTop(side).withSizeKeepingCentre(side, side);
-            slider.setBounds(dialArea.reduced(2));
+            slider.setBounds(dialArea.reduced(sliderInsetPx));
             return;
         }
 
@@ -301,17 +319,17 @@ public:
 
             const int side = juce::jmin(bounds.getWidth(), bounds.getHeight());
             auto dialArea = bounds.removeFromTop(side).withSizeKeepingCentre(side, side);
-            slider.setBounds(dialArea.reduced(2));
+            slider.setBounds(dialArea.reduced(sliderInsetPx));
 
             label.setBounds(labelArea.translated(0, -labelRaisePx + labelYOffsetPx));
 
-            label.setFont(StudioStyle::Fonts::dialLabelFont());
+            label.setFont(labelFont);
             return;
         }
 
         // No label: just a square dial.
         const int side = juce::jmin(bounds.getWidth(), bounds.getHeight());
-        slider.setBounds(bounds.withSizeKeepingCentre(side, side).reduced(2));
+        slider.setBounds(bounds.withSizeKeepingCentre(side, side).reduced(sliderInsetPx));
     }
 
 private:
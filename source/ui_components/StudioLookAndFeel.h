@@ -2,17 +2,25 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include <unordered_map>
+
+#include "DialFrameCache.h"
 #include "RotaryDial.h"
 #include "StudioStyle.h"
+#include "UiScale.h"
+#include "ValueTextCache.h"
 
 // Centralised styling (fonts + colours) for the plugin UI.
-class StudioLookAndFeel : public juce::LookAndFeel_V4
+class StudioLookAndFeel : public PopupScaledLookAndFeel
 {
 public:
     StudioLookAndFeel()
     {
         // Enforce a consistent sans-serif base.
-        setDefaultSansSerifTypefaceName(StudioStyle::Fonts::condensedFamilyTypefaceName());
+        if (auto typeface = StudioStyle::Fonts::condensedTypeface())
+            setDefaultSansSerifTypeface(typeface);
+        else
+            setDefaultSansSerifTypefaceName(StudioStyle::Fonts::condensedFamilyTypefaceName());
 
         setColour(juce::Label::textColourId, StudioStyle::Colours::foreground);
         setColour(juce::Slider::rotarySliderFillColourId, StudioStyle::Colours::accent);
@@ -23,19 +31,17 @@ public:
 
     juce::Font getLabelFont(juce::Label& label) override
     {
-        juce::ignoreUnused(label);
-        return makeCondensedBold(StudioStyle::Fonts::SizePx::uiLabel);
+        return makeCondensedBold(StudioStyle::Fonts::SizePx::uiLabel * UiScale::of(label));
     }
 
     juce::Font getSliderPopupFont(juce::Slider& slider) override
     {
-        juce::ignoreUnused(slider);
-        return makeCondensedBold(StudioStyle::Fonts::SizePx::sliderPopup);
+        return makeCondensedBold(StudioStyle::Fonts::SizePx::sliderPopup * UiScale::of(slider));
     }
 
     juce::Font getPopupMenuFont() override
     {
-        return makeCondensedBold(StudioStyle::Fonts::SizePx::popupMenu);
+        return makeCondensedBold(StudioStyle::Fonts::SizePx::popupMenu * popupScale);
     }
 
     // Custom rotary dial drawing for our RotaryDialSlider.
@@ -56,6 +62,27 @@ private:
         return withDefaultMetrics(StudioStyle::Fonts::condensedBoldOptions(heightPx));
     }
 
+    // Dial text fonts, built once per height instead of on every dial paint.
+    const juce::Font& dialFont(float heightPx)
+    {
+        auto it = dialFonts.find(heightPx);
+        if (it == dialFonts.end())
+        {
+            // Heights follow the editor scale, so live resizing keeps producing new ones.
+            if (dialFonts.size() > 32)
+                dialFonts.clear();
+
+            it = dialFonts.emplace(heightPx, makeCondensedBold(heightPx)).first;
+        }
+
+        return it->second;
+    }
+
+    // Shared by every editor instance, so several open editors rasterize each dial style once.
+    juce::SharedResourcePointer<DialFrameCache> dialFrames;
+    juce::SharedResourcePointer<ValueTextCache> valueTexts;
+    std::unordered_map<float, juce::Font> dialFonts;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StudioLookAndFeel)
 };
 
@@ -77,130 +104,34 @@ inline void StudioLookAndFeel::drawRotarySlider(juce::Graphics& g,
         return;
     }
 
-    const auto area = juce::Rectangle<float>((float) x, (float) y, (float) width, (float) height).reduced(2.0f);
-    const auto side = juce::jmin(area.getWidth(), area.getHeight());
-    const auto squareArea = area.withSizeKeepingCentre(side, side);
-
-    auto ringArea = squareArea.withSizeKeepingCentre(side * dial->ringScale, side * dial->ringScale);
-    ringArea = ringArea.expanded(dial->ringOutsetPx).getIntersection(squareArea);
-    ringArea = ringArea.reduced(StudioStyle::Sizes::dialArcRadiusTrimPx);
-
-    const auto ringColour = juce::Colour(0xFF727676);
+    const auto bounds = juce::Rectangle<int>(x, y, width, height);
+    const float uiScale = UiScale::of(s);
     const auto valueColour = s.findColour(juce::Slider::rotarySliderFillColourId);
 
-    // Path::addCentredArc: 0 at 12 o'clock, increasing clockwise.
-    const float spanRad = juce::degreesToRadians(dial->ringSpanDegrees);
-    const float midAngle = juce::degreesToRadians(dial->ringRotationDegrees);
-    const float startAngle = midAngle - spanRad * 0.5f;
-    const float endAngle = startAngle + spanRad;
-
-    const auto toCosSinAngle = [](float arcAngle)
-    {
-        // Convert arc angle (0 at 12) -> cos/sin angle (0 at 3)
-        return arcAngle - juce::MathConstants<float>::halfPi;
-    };
-
-    const auto centre = ringArea.getCentre();
-    const float radius = ringArea.getWidth() * 0.5f;
-    const float ringThickness = juce::jmin(dial->ringThicknessPx, radius - 2.0f);
-    const auto ringBounds = ringArea.reduced(ringThickness * 0.5f);
-
-    // Background ring
-    {
-        juce::Path backgroundArc;
-        backgroundArc.addCentredArc(centre.x, centre.y,
-                                    ringBounds.getWidth() * 0.5f,
-                                    ringBounds.getHeight() * 0.5f,
-                                    0.0f, startAngle, endAngle, true);
-        g.setColour(ringColour);
-        g.strokePath(backgroundArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    }
-
-    // Value indicator
-    if (dial->mode == RotaryDialSlider::DialMode::UnipolarRing)
-    {
-        const float valueAngle = startAngle + sliderPosProportional * spanRad;
-        juce::Path valueArc;
-        valueArc.addCentredArc(centre.x, centre.y,
-                               ringBounds.getWidth() * 0.5f,
-                               ringBounds.getHeight() * 0.5f,
-                               0.0f, startAngle, valueAngle, true);
-        g.setColour(valueColour);
-        g.strokePath(valueArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    }
-    else if (dial->mode == RotaryDialSlider::DialMode::BipolarRing)
-    {
-        const float a0 = midAngle;
-        const float a1 = startAngle + sliderPosProportional * spanRad;
-
-        juce::Path valueArc;
-        valueArc.addCentredArc(centre.x, centre.y,
-                               ringBounds.getWidth() * 0.5f,
-                               ringBounds.getHeight() * 0.5f,
-                               0.0f, juce::jmin(a0, a1), juce::jmax(a0, a1), true);
-        g.setColour(valueColour);
-        g.strokePath(valueArc, juce::PathStrokeType(ringThickness, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
-    }
-    else if (dial->mode == RotaryDialSlider::DialMode::Needle)
-    {
-        const float valueAngle = startAngle + sliderPosProportional * spanRad;
-        const auto vp = toCosSinAngle(valueAngle);
-
-        g.setColour(valueColour);
-        const float needleLen = radius * 0.42f;
-        const float needleStart = radius * 0.16f;
-
-        const auto p0 = centre + juce::Point<float>(std::cos(vp), std::sin(vp)) * needleStart;
-        const auto p1 = centre + juce::Point<float>(std::cos(vp), std::sin(vp)) * (needleStart + needleLen);
-        g.drawLine({ p0.x, p0.y, p1.x, p1.y }, 2.0f);
-    }
-
-    // Range text
-    if (dial->rangeDisplay == RotaryDialSlider::RangeDisplay::MinMax)
-    {
-        const auto minText = s.getTextFromValue(s.getMinimum());
-        const auto maxText = s.getTextFromValue(s.getMaximum());
-
-        const auto textRadius = radius - ringThickness - 10.0f;
-        const auto startP = toCosSinAngle(startAngle);
-        const auto endP = toCosSinAngle(endAngle);
-        const auto minPos = centre + juce::Point<float>(std::cos(startP), std::sin(startP)) * textRadius;
-        const auto maxPos = centre + juce::Point<float>(std::cos(endP), std::sin(endP)) * textRadius;
-
-        g.setColour(StudioStyle::Colours::foreground.withAlpha(0.75f));
-        g.setFont(makeCondensedBold(StudioStyle::Fonts::SizePx::dialRangeText));
-
-        const auto rMin = juce::Rectangle<float>(0, 0, 48, 16).withCentre(minPos);
-        const auto rMax = juce::Rectangle<float>(0, 0, 48, 16).withCentre(maxPos);
-        g.drawFittedText(minText, rMin.toNearestInt(), juce::Justification::centred, 1);
-        g.drawFittedText(maxText, rMax.toNearestInt(), juce::Justification::centred, 1);
-    }
-
-    // Dial image (between ring and value text)
-    if (dial->dialImage.isValid())
-    {
-        auto imageBounds = squareArea.reduced(ringThickness + dial->dialImagePaddingPx);
-        imageBounds = imageBounds.translated(dial->dialImageOffsetPx, dial->dialImageOffsetPx);
-        g.setOpacity(1.0f);
-        g.drawImageWithin(dial->dialImage,
-                          (int) imageBounds.getX(),
-                          (int) imageBounds.getY(),
-                          (int) imageBounds.getWidth(),
-                          (int) imageBounds.getHeight(),
-                          juce::RectanglePlacement::centred);
-    }
+    // Ring, value indicator, range text and knob image come from pre-rendered frames.
+    dialFrames->draw(g, *dial, bounds, sliderPosProportional, valueColour,
+                     dialFont(StudioStyle::Fonts::SizePx::dialRangeText * uiScale));
 
     // Center value text
     {
-        const auto valueBounds = squareArea.reduced(ringThickness + 10.0f);
+        const auto geo = DialFrameCache::layout(*dial, bounds.toFloat(), uiScale);
+        const auto valueBounds = geo.squareArea.reduced(geo.ringThickness + 10.0f * uiScale);
         auto valueTextColour = StudioStyle::Colours::foreground;
         if (s.isColourSpecified(juce::Slider::textBoxTextColourId))
             valueTextColour = s.findColour(juce::Slider::textBoxTextColourId);
 
         g.setColour(valueTextColour);
-        g.setFont(makeCondensedBold(dial->valueFontHeightPx));
-
-        const auto text = s.getTextFromValue(s.getValue());
-        g.drawFittedText(text, valueBounds.toNearestInt(), juce::Justification::centred, 1);
+        const auto& font = dialFont(dial->valueFontHeightPx * uiScale);
+
+        // Stepped ranges draw an interned, pre-shaped text; anything else is formatted here.
+        if (const auto* text = dial->valueTexts.find(s, s.getValue()))
+        {
+            valueTexts->drawFittedText(g, *text, font, valueBounds.toNearestInt(), juce::Justification::centred);
+        }
+        else
+        {
+            g.setFont(font);
+            g.drawFittedText(s.getTextFromValue(s.getValue()), valueBounds.toNearestInt(), juce::Justification::centred, 1);
+        }
     }
 }
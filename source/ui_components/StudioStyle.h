@@ -4,62 +4,83 @@
 
 #include <initializer_list>
 
+#if MODELCYCLES_EMBEDDED_CONDENSED_FONT || MODELCYCLES_EMBEDDED_ALPHASMART_FONT
+ #include "BinaryData.h"
+#endif
+
 // Centralised UI tokens (colours + sizes).
 // Keep this header dependency-light so it can be included from components and LookAndFeel.
 struct StudioStyle
 {
     struct Fonts
     {
-        static const juce::String& alphaSmartFamilyTypefaceName()
+        // Typefaces embedded at build time (MODELCYCLES_CONDENSED_FONT / MODELCYCLES_ALPHASMART_FONT
+        // in CMakeLists.txt), loaded straight from memory; null when not embedded.
+        static juce::Typeface::Ptr condensedTypeface()
         {
-            static const juce::String name = []
+            static const juce::Typeface::Ptr typeface = []() -> juce::Typeface::Ptr
             {
-                const auto names = juce::Font::findAllTypefaceNames();
-                const auto pick = [&](std::initializer_list<const char*> candidates) -> juce::String
-                {
-                    for (auto* c : candidates)
-                        if (names.contains(juce::String(c), true))
-                            return c;
-                    return {};
-                };
-
-                if (auto s = pick({ "AlphaSmart 3000", "AlphaSmart" }); s.isNotEmpty())
-                    return s;
-
-                // Fallback: default sans if AlphaSmart isn't installed.
-                return juce::Font::getDefaultSansSerifFontName();
+               #if MODELCYCLES_EMBEDDED_CONDENSED_FONT
+                return juce::Typeface::createSystemTypefaceFor(BinaryData::CondensedFace_ttf, (size_t) BinaryData::CondensedFace_ttfSize);
+               #else
+                return {};
+               #endif
             }();
 
-            return name;
+            return typeface;
         }
 
-        static const juce::String& condensedFamilyTypefaceName()
+        static juce::Typeface::Ptr alphaSmartTypeface()
         {
-            static const juce::String name = []
+            static const juce::Typeface::Ptr typeface = []() -> juce::Typeface::Ptr
             {
-                const auto names = juce::Font::findAllTypefaceNames();
-
-                const auto pick = [&](std::initializer_list<const char*> candidates) -> juce::String
-                {
-                    for (auto* c : candidates)
-                        if (names.contains(juce::String(c), true))
-                            return c;
-                    return {};
-                };
-
-                // Prefer an actually-condensed face.
-                // User request: Arial Narrow + juce::Font::bold.
-                if (auto s = pick({ "Arial Narrow", "ArialNarrow", "Arial Narrow Bold", "Arial Bold" }); s.isNotEmpty())
-                    return s;
-
-                return juce::Font::getDefaultSansSerifFontName();
+               #if MODELCYCLES_EMBEDDED_ALPHASMART_FONT
+                return juce::Typeface::createSystemTypefaceFor(BinaryData::AlphaSmartFace_ttf, (size_t) BinaryData::AlphaSmartFace_ttfSize);
+               #else
+                return {};
+               #endif
             }();
 
+            return typeface;
+        }
+
+        // Without an embedded face, the first candidate family the system resolves to itself, else
+        // the default sans. Each candidate costs one typeface lookup; the system fonts are never
+        // enumerated (on Linux with a large fontconfig set that alone held up the first editor open).
+        static juce::String firstInstalledFamily(std::initializer_list<const char*> candidates)
+        {
+            for (auto* c : candidates)
+                if (auto typeface = juce::Font(juce::FontOptions { c, 12.0f, juce::Font::plain }).getTypefacePtr())
+                    if (typeface->getName().equalsIgnoreCase(c))
+                        return c;
+
+            return juce::Font::getDefaultSansSerifFontName();
+        }
+
+        static const juce::String& alphaSmartFamilyTypefaceName()
+        {
+            static const juce::String name = alphaSmartTypeface() != nullptr
+                                                 ? alphaSmartTypeface()->getName()
+                                                 : firstInstalledFamily({ "AlphaSmart 3000", "AlphaSmart" });
+            return name;
+        }
+
+        static const juce::String& condensedFamilyTypefaceName()
+        {
+            // Prefer an actually-condensed face.
+            // User request: Arial Narrow + juce::Font::bold.
+            static const juce::String name = condensedTypeface() != nullptr
+                                                 ? condensedTypeface()->getName()
+                                                 : firstInstalledFamily({ "Arial Narrow", "ArialNarrow", "Arial Narrow Bold", "Arial Bold" });
             return name;
         }
 
         static juce::FontOptions condensedBoldOptions(float heightPx)
         {
+            // The embedded condensed face is the bold cut.
+            if (auto typeface = condensedTypeface())
+                return juce::FontOptions { typeface }.withHeight(heightPx);
+
             return juce::FontOptions { condensedFamilyTypefaceName(), heightPx, juce::Font::bold };
         }
 
@@ -70,6 +91,9 @@ struct StudioStyle
 
         static juce::FontOptions alphaSmartPlainOptions(float heightPx)
         {
+            if (auto typeface = alphaSmartTypeface())
+                return juce::FontOptions { typeface }.withHeight(heightPx);
+
             return juce::FontOptions { alphaSmartFamilyTypefaceName(), heightPx, juce::Font::plain };
         }
 
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+// Button artwork (the BinaryData SVGs), shared by every button in every editor (hold it in a
+// juce::SharedResourcePointer). Each SVG is parsed once; each (asset, size, display scale, tint)
+// it is drawn at is rasterised once, so painting a button icon is an image blit instead of a
+// Drawable render.
+//
+// Assets are identified by their data pointer, so the data must outlive the cache (BinaryData
+// does). The rasters are dropped once they grow past maxBytes.
+class SvgArtworkCache final
+{
+public:
+    static constexpr size_t maxBytes = (size_t) 8 * 1024 * 1024;
+
+    struct Asset
+    {
+        const void* data { nullptr };
+        int bytes { 0 };
+
+        bool isValid() const noexcept { return data != nullptr && bytes > 0; }
+    };
+
+    SvgArtworkCache() = default;
+
+    // Message thread. The parsed artwork (owned by the cache), or nullptr if it isn't an image.
+    const juce::Drawable* getDrawable(Asset asset)
+    {
+        if (! asset.isValid())
+            return nullptr;
+
+        auto& drawable = drawables[asset.data];
+        if (drawable == nullptr)
+            drawable = juce::Drawable::createFromImageData(asset.data, (size_t) asset.bytes);
+
+        return drawable.get();
+    }
+
+    // Message thread. Draws the artwork centred within `area` at the context's physical pixel
+    // scale. A non-transparent `tint` replaces the artwork's foreground colours (the shipped SVGs
+    // are monochrome: black / 0xFF021616).
+    void draw(juce::Graphics& g, Asset asset, juce::Rectangle<float> area, juce::Colour tint = {})
+    {
+        if (area.isEmpty())
+            return;
+
+        if (totalBytes > maxBytes)
+        {
+            rasters.clear();
+            totalBytes = 0;
+        }
+
+        Key key;
+        key.data = asset.data;
+        key.width = area.getWidth();
+        key.height = area.getHeight();
+        key.scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        key.tintArgb = tint.getARGB();
+
+        auto& image = rasters[key];
+        if (image.isNull())
+        {
+            auto* drawable = getDrawable(asset);
+            if (drawable == nullptr)
+                return;
+
+            image = render(key, tint.isTransparent() ? drawable : tinted(*drawable, tint));
+        }
+
+        g.setOpacity(1.0f);
+        g.drawImage(image, area);
+    }
+
+private:
+    struct Key
+    {
+        const void* data { nullptr };
+        float width { 0.0f };
+        float height { 0.0f };
+        float scale { 1.0f };
+        juce::uint32 tintArgb { 0 };
+
+        bool operator==(const Key& o) const
+        {
+            return data == o.data && width == o.width && height == o.height
+                && scale == o.scale && tintArgb == o.tintArgb;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& k) const noexcept
+        {
+            size_t h = 0;
+            const auto mix = [&h] (size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+
+            mix(std::hash<const void*>()(k.data));
+            mix(std::hash<float>()(k.width));
+            mix(std::hash<float>()(k.height));
+            mix(std::hash<float>()(k.scale));
+            mix((size_t) k.tintArgb);
+            return h;
+        }
+    };
+
+    const juce::Drawable* tinted(const juce::Drawable& source, juce::Colour tint)
+    {
+        auto& copy = tintedDrawables[{ &source, tint.getARGB() }];
+        if (copy == nullptr)
+        {
+            copy = source.createCopy();
+            copy->replaceColour(juce::Colours::black, tint);
+            copy->replaceColour(juce::Colour(0xFF021616), tint);
+        }
+
+        return copy.get();
+    }
+
+    juce::Image render(const Key& key, const juce::Drawable* drawable)
+    {
+        const int w = juce::jmax(1, (int) std::ceil(key.width * key.scale));
+        const int h = juce::jmax(1, (int) std::ceil(key.height * key.scale));
+
+        juce::Image image (juce::Image::ARGB, w, h, true);
+        {
+            juce::Graphics ig (image);
+            drawable->drawWithin(ig, { 0.0f, 0.0f, (float) w, (float) h }, juce::RectanglePlacement::centred, 1.0f);
+        }
+
+        totalBytes += (size_t) w * (size_t) h * 4;
+        return image;
+    }
+
+    std::unordered_map<const void*, std::unique_ptr<juce::Drawable>> drawables;
+    std::map<std::pair<const juce::Drawable*, juce::uint32>, std::unique_ptr<juce::Drawable>> tintedDrawables;
+    std::unordered_map<Key, juce::Image, KeyHash> rasters;
+    size_t totalBytes { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SvgArtworkCache)
+};
@@ -3,6 +3,8 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 
 #include "StudioStyle.h"
+#include "SvgArtworkCache.h"
+#include "UiScale.h"
 
 class TextMiniToggle final : public juce::ToggleButton
 {
@@ -11,8 +13,8 @@ public:
 
     void setImagesFromMemory(const void* offData, int offBytes, const void* onData, int onBytes)
     {
-        offDrawable = createDrawableFromData(offData, offBytes);
-        onDrawable = createDrawableFromData(onData, onBytes);
+        offArtwork = { offData, offBytes };
+        onArtwork = { onData, onBytes };
         repaint();
     }
 
@@ -45,38 +47,32 @@ public:
         juce::ignoreUnused(isMouseOverButton, isButtonDown);
 
         const auto outer = getLocalBounds().toFloat();
+        const float uiScale = UiScale::of(*this);
 
         // Black rounded rectangle background.
         g.setColour(juce::Colours::black);
-        g.fillRoundedRectangle(outer, cornerRadiusPx);
+        g.fillRoundedRectangle(outer, cornerRadiusPx * uiScale);
 
         // Optional SVG artwork (e.g. BUTTON_OFF/BUTTON_ON) under the glyph.
-        if (auto* drawable = getToggleState() ? onDrawable.get() : offDrawable.get())
+        if (const auto artwork = getToggleState() ? onArtwork : offArtwork; artwork.isValid())
         {
-            auto imageBounds = outer.reduced(2.0f);
-            drawable->drawWithin(g, imageBounds, juce::RectanglePlacement::centred, 1.0f);
+            auto imageBounds = outer.reduced(2.0f * uiScale);
+            artworkCache->draw(g, artwork, imageBounds);
         }
 
         g.setColour(glyphColour);
-        g.setFont(glyphFont);
+        g.setFont(glyphFont.withHeight(glyphFont.getHeight() * uiScale));
 
-        const auto inset = getLocalBounds().reduced(1);
+        const auto inset = getLocalBounds().reduced(juce::roundToInt(uiScale));
         g.drawFittedText(glyphText, inset, juce::Justification::centred, 1);
     }
 
 private:
-    static std::unique_ptr<juce::Drawable> createDrawableFromData(const void* data, int bytes)
-    {
-        if (data == nullptr || bytes <= 0)
-            return {};
-
-        return juce::Drawable::createFromImageData(data, (size_t) bytes);
-    }
-
     float cornerRadiusPx { 4.0f };
 
-    std::unique_ptr<juce::Drawable> offDrawable;
-    std::unique_ptr<juce::Drawable> onDrawable;
+    juce::SharedResourcePointer<SvgArtworkCache> artworkCache;
+    SvgArtworkCache::Asset offArtwork;
+    SvgArtworkCache::Asset onArtwork;
 
     juce::String glyphText { "S" };
     juce::Colour glyphColour { juce::Colours::white };
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <array>
+#include <atomic>
+
+#include "../ParameterIds.h"
+
+// Binds one control to the same field of all six tracks and shows whichever track is active.
+// The six parameters are resolved by dense index and listened to once, at construction, so
+// switching tracks is setTrack(): re-point the control and push the new track's value, with no
+// string lookups, listener registration or attachment rebuilds. Mirrors the behaviour of the
+// juce::AudioProcessorValueTreeState attachments (gestures, host notification, sync UI updates).
+class TrackParameterAttachment : private juce::AudioProcessorParameter::Listener,
+                                 private juce::AsyncUpdater
+{
+public:
+    static constexpr int numTracks = ParameterIds::numTracks;
+
+    ~TrackParameterAttachment() override
+    {
+        cancelPendingUpdate();
+
+        for (auto* p : parameters)
+            if (p != nullptr)
+                p->removeListener(this);
+    }
+
+    // Message thread.
+    void setTrack(int trackIndex0To5)
+    {
+        activeTrack.store(juce::jlimit(0, numTracks - 1, trackIndex0To5), std::memory_order_relaxed);
+        cancelPendingUpdate();
+        handleAsyncUpdate();
+    }
+
+    int getTrack() const noexcept { return activeTrack.load(std::memory_order_relaxed); }
+
+protected:
+    TrackParameterAttachment(juce::AudioProcessor& processor, ParameterIds::TrackField fieldToUse)
+        : field(fieldToUse)
+    {
+        const auto& all = processor.getParameters();
+
+        for (int t = 0; t < numTracks; ++t)
+        {
+            auto* p = dynamic_cast<juce::RangedAudioParameter*>(all[ParameterIds::index(t, field)]);
+            parameters[(size_t) t] = p;
+
+            if (p != nullptr)
+                p->addListener(this);
+        }
+    }
+
+    // Tracks share ranges and formatting, so track 1's parameter describes the control.
+    juce::RangedAudioParameter* firstParameter() const noexcept { return parameters[0]; }
+
+    juce::RangedAudioParameter* activeParameter() const noexcept { return parameters[(size_t) getTrack()]; }
+
+    // Called by subclasses on the message thread (plain, denormalised values).
+    void beginGesture()
+    {
+        if (auto* p = activeParameter())
+            p->beginChangeGesture();
+    }
+
+    void endGesture()
+    {
+        if (auto* p = activeParameter())
+            p->endChangeGesture();
+    }
+
+    void setValueAsPartOfGesture(float plainValue)
+    {
+        if (ignoreCallbacks)
+            return;
+
+        if (auto* p = activeParameter())
+        {
+            const auto normalised = p->convertTo0to1(plainValue);
+            if (p->getValue() != normalised)
+                p->setValueNotifyingHost(normalised);
+        }
+    }
+
+    void setValueAsCompleteGesture(float plainValue)
+    {
+        if (ignoreCallbacks)
+            return;
+
+        beginGesture();
+        setValueAsPartOfGesture(plainValue);
+        endGesture();
+    }
+
+    bool isUpdatingControl() const noexcept { return ignoreCallbacks; }
+
+    // Message thread. Show the active track's value without echoing it back to the parameter.
+    virtual void showValue(float plainValue) = 0;
+
+    // Subclasses call this at the end of their constructor.
+    void sendInitialUpdate()
+    {
+        handleAsyncUpdate();
+    }
+
+private:
+    void parameterValueChanged(int parameterIndex, float newValue) override
+    {
+        juce::ignoreUnused(newValue);
+
+        if (parameterIndex != ParameterIds::index(getTrack(), field))
+            return;
+
+        if (juce::MessageManager::getInstance()->isThisTheMessageThread())
+        {
+            cancelPendingUpdate();
+            handleAsyncUpdate();
+        }
+        else
+        {
+            triggerAsyncUpdate();
+        }
+    }
+
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override
+    {
+        juce::ignoreUnused(parameterIndex, gestureIsStarting);
+    }
+
+    void handleAsyncUpdate() override
+    {
+        auto* p = activeParameter();
+        if (p == nullptr)
+            return;
+
+        const juce::ScopedValueSetter<bool> guard(ignoreCallbacks, true);
+        showValue(p->convertFrom0to1(p->getValue()));
+    }
+
+    const ParameterIds::TrackField field;
+    std::array<juce::RangedAudioParameter*, numTracks> parameters {};
+    std::atomic<int> activeTrack { 0 };
+    bool ignoreCallbacks { false };
+
+    JUCE_DECLARE_NON_COPYABLE(TrackParameterAttachment)
+};
+
+class TrackSliderAttachment final : public TrackParameterAttachment,
+                                    private juce::Slider::Listener
+{
+public:
+    TrackSliderAttachment(juce::AudioProcessor& processor, ParameterIds::TrackField fieldToUse, juce::Slider& sliderToUse)
+        : TrackParameterAttachment(processor, fieldToUse), slider(sliderToUse)
+    {
+        // Same slider setup as SliderAttachment, taken once from the shared range.
+        if (auto* p = firstParameter())
+        {
+            slider.valueFromTextFunction = [p] (const juce::String& text) { return (double) p->convertFrom0to1(p->getValueForText(text)); };
+            slider.textFromValueFunction = [p] (double value) { return p->getText(p->convertTo0to1((float) value), 0); };
+            slider.setDoubleClickReturnValue(true, p->convertFrom0to1(p->getDefaultValue()));
+
+            const auto range = p->getNormalisableRange();
+            slider.setNormalisableRange({ (double) range.start, (double) range.end, (double) range.interval, (double) range.skew, range.symmetricSkew });
+        }
+
+        sendInitialUpdate();
+        slider.valueChanged();
+        slider.addListener(this);
+    }
+
+    ~TrackSliderAttachment() override
+    {
+        slider.removeListener(this);
+    }
+
+private:
+    void showValue(float plainValue) override
+    {
+        slider.setValue(plainValue, juce::sendNotificationSync);
+    }
+
+    void sliderValueChanged(juce::Slider*) override
+    {
+        if (isUpdatingControl())
+            return;
+
+        if (slider.isMouseButtonDown())
+            setValueAsPartOfGesture((float) slider.getValue());
+        else
+            setValueAsCompleteGesture((float) slider.getValue());
+    }
+
+    void sliderDragStarted(juce::Slider*) override { beginGesture(); }
+    void sliderDragEnded(juce::Slider*) override { endGesture(); }
+
+    juce::Slider& slider;
+};
+
+class TrackButtonAttachment final : public TrackParameterAttachment,
+                                    private juce::Button::Listener
+{
+public:
+    TrackButtonAttachment(juce::AudioProcessor& processor, ParameterIds::TrackField fieldToUse, juce::Button& buttonToUse)
+        : TrackParameterAttachment(processor, fieldToUse), button(buttonToUse)
+    {
+        sendInitialUpdate();
+        button.addListener(this);
+    }
+
+    ~TrackButtonAttachment() override
+    {
+        button.removeListener(this);
+    }
+
+private:
+    void showValue(float plainValue) override
+    {
+        button.setToggleState(plainValue >= 0.5f, juce::sendNotificationSync);
+    }
+
+    void buttonClicked(juce::Button*) override
+    {
+        setValueAsCompleteGesture(button.getToggleState() ? 1.0f : 0.0f);
+    }
+
+    juce::Button& button;
+};
+
+class TrackComboBoxAttachment final : public TrackParameterAttachment,
+                                      private juce::ComboBox::Listener
+{
+public:
+    TrackComboBoxAttachment(juce::AudioProcessor& processor, ParameterIds::TrackField fieldToUse, juce::ComboBox& comboToUse)
+        : TrackParameterAttachment(processor, fieldToUse), combo(comboToUse)
+    {
+        sendInitialUpdate();
+        combo.addListener(this);
+    }
+
+    ~TrackComboBoxAttachment() override
+    {
+        combo.removeListener(this);
+    }
+
+private:
+    // Items are the parameter's choices in order, so the item index is the plain value.
+    void showValue(float plainValue) override
+    {
+        if (auto* p = activeParameter())
+        {
+            const int numItems = combo.getNumItems();
+            const int index = juce::roundToInt(p->convertTo0to1(plainValue) * (float) juce::jmax(0, numItems - 1));
+            combo.setSelectedItemIndex(index, juce::sendNotificationSync);
+        }
+    }
+
+    void comboBoxChanged(juce::ComboBox*) override
+    {
+        auto* p = activeParameter();
+        if (p == nullptr || isUpdatingControl())
+            return;
+
+        const int numItems = combo.getNumItems();
+        const float normalised = numItems > 1 ? (float) combo.getSelectedItemIndex() / (float) (numItems - 1) : 0.0f;
+        setValueAsCompleteGesture(p->convertFrom0to1(normalised));
+    }
+
+    juce::ComboBox& combo;
+};
@@ -2,7 +2,10 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+#include "CachedBackdrop.h"
 #include "StudioStyle.h"
+#include "SvgArtworkCache.h"
+#include "UiScale.h"
 
 class TrackSelectorButton final : public juce::ToggleButton
 {
@@ -26,14 +29,15 @@ public:
 
     void setImagesFromMemory(const void* offData, int offBytes, const void* onData, int onBytes)
     {
-        offDrawable = createDrawableFromData(offData, offBytes);
-        onDrawable = createDrawableFromData(onData, onBytes);
+        offArtwork = { offData, offBytes };
+        onArtwork = { onData, onBytes };
         repaint();
     }
 
     void setCornerRadius(float newRadiusPx)
     {
         cornerRadiusPx = juce::jmax(0.0f, newRadiusPx);
+        backdrop.invalidate();
         repaint();
     }
 
@@ -42,55 +46,31 @@ public:
         juce::ignoreUnused(isMouseOverButton, isButtonDown);
 
         const auto outer = getLocalBounds().toFloat();
+        const float uiScale = UiScale::of(*this);
 
-        // A: black rounded-rect background (full size)
-        //g.setColour(muted ? mutedOutline : StudioStyle::Colours::buttonOutline);
-        g.setColour(muted ?  StudioStyle::Colours::buttonOutline : StudioStyle::Colours::buttonOutline);
-        g.fillRoundedRectangle(outer, cornerRadiusPx);
-
-        // B: inner gradient rounded-rect (inset by outlinePx)
-        auto b = outer.reduced(StudioStyle::Sizes::buttonOutlinePx);
-
-        const auto light = StudioStyle::Colours::buttonLight.brighter(0.5f);
-        const auto dark  = StudioStyle::Colours::buttonDark;
-
-        juce::ColourGradient grad(light, b.getTopLeft(), dark, b.getBottomRight(), false);
-        grad.addColour(0.00, light);
-        grad.addColour(StudioStyle::Sizes::gradientBandStart, light);
-        grad.addColour(StudioStyle::Sizes::gradientBandEnd, dark);
-        grad.addColour(1.00, dark);
-
-        if (isButtonDown)
-            grad.multiplyOpacity(0.95f);
-
-        g.setGradientFill(grad);
-        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerRadiusPx - StudioStyle::Sizes::buttonOutlinePx));
+        // A-C only change while the button is held down, so both looks come from the backdrop cache.
+        backdrop.draw(g, outer,
+                      [this, isButtonDown, uiScale] (juce::Graphics& bg, juce::Rectangle<float> area) { paintBackdrop(bg, area, isButtonDown, uiScale); },
+                      isButtonDown ? 1 : 0);
 
-        // C: midGrey plate (~0.7 of inner) - slightly larger for track buttons
+        const auto b = outer.reduced(StudioStyle::Sizes::buttonOutlinePx * uiScale);
         const auto side = juce::jmin(b.getWidth(), b.getHeight());
-        constexpr float plateMul = 1.10f;
-        auto plateBounds = b.withSizeKeepingCentre(side * (StudioStyle::Sizes::buttonPlateScale * plateMul),
-                               side * (StudioStyle::Sizes::buttonPlateScale * plateMul));
-
-        const float plateCorner = juce::jmin(cornerRadiusPx * 0.44f, plateBounds.getHeight() * 0.22f);
-        g.setColour(StudioStyle::Colours::buttonPlate);
-        g.fillRoundedRectangle(plateBounds, plateCorner);
 
         // Icon (same behaviour as ImageToggle: only ON/OFF artwork changes)
-        if (auto* drawable = getToggleState() ? onDrawable.get() : offDrawable.get())
+        if (const auto artwork = getToggleState() ? onArtwork : offArtwork; artwork.isValid())
         {
             constexpr float iconMul = 1.10f;
             auto imageBounds = b.withSizeKeepingCentre(side * (StudioStyle::Sizes::buttonIconScale * iconMul),
                                                        side * (StudioStyle::Sizes::buttonIconScale * iconMul));
-            drawable->drawWithin(g, imageBounds, juce::RectanglePlacement::centred, 1.0f);
+            artworkCache->draw(g, artwork, imageBounds);
         }
 
         // Label
         auto text = getButtonText();
         if (text.isNotEmpty())
         {
-            auto textBounds = plateBounds.toNearestInt();
-            g.setFont(StudioStyle::Fonts::trackButtonLabelFont());
+            auto textBounds = plateArea(b).toNearestInt();
+            g.setFont(StudioStyle::Fonts::condensedBold(StudioStyle::Fonts::SizePx::trackButtonLabel * uiScale));
 
             // Always white (ON/OFF is communicated only via the artwork).
             g.setColour(StudioStyle::Colours::foreground);
@@ -119,12 +99,49 @@ public:
     }
 
 private:
-    static std::unique_ptr<juce::Drawable> createDrawableFromData(const void* data, int bytes)
+    // Slightly larger than the ImageToggle plate.
+    static juce::Rectangle<float> plateArea(juce::Rectangle<float> inner)
+    {
+        const auto side = juce::jmin(inner.getWidth(), inner.getHeight());
+        constexpr float plateMul = 1.10f;
+        return inner.withSizeKeepingCentre(side * (StudioStyle::Sizes::buttonPlateScale * plateMul),
+                                           side * (StudioStyle::Sizes::buttonPlateScale * plateMul));
+    }
+
+    void paintBackdrop(juce::Graphics& g, juce::Rectangle<float> outer, bool isButtonDown, float uiScale) const
     {
-        if (data == nullptr || bytes <= 0)
-            return {};
+        const float cornerPx = cornerRadiusPx * uiScale;
+        const float outlinePx = StudioStyle::Sizes::buttonOutlinePx * uiScale;
+
+        // A: black rounded-rect background (full size)
+        //g.setColour(muted ? mutedOutline : StudioStyle::Colours::buttonOutline);
+        g.setColour(StudioStyle::Colours::buttonOutline);
+        g.fillRoundedRectangle(outer, cornerPx);
+
+        // B: inner gradient rounded-rect (inset by outlinePx)
+        auto b = outer.reduced(outlinePx);
+
+        const auto light = StudioStyle::Colours::buttonLight.brighter(0.5f);
+        const auto dark  = StudioStyle::Colours::buttonDark;
+
+        juce::ColourGradient grad(light, b.getTopLeft(), dark, b.getBottomRight(), false);
+        grad.addColour(0.00, light);
+        grad.addColour(StudioStyle::Sizes::gradientBandStart, light);
+        grad.addColour(StudioStyle::Sizes::gradientBandEnd, dark);
+        grad.addColour(1.00, dark);
+
+        if (isButtonDown)
+            grad.multiplyOpacity(0.95f);
+
+        g.setGradientFill(grad);
+        g.fillRoundedRectangle(b, juce::jmax(0.0f, cornerPx - outlinePx));
 
-        return juce::Drawable::createFromImageData(data, (size_t) bytes);
+        // C: midGrey plate (~0.7 of inner)
+        auto plateBounds = plateArea(b);
+
+        const float plateCorner = juce::jmin(cornerPx * 0.44f, plateBounds.getHeight() * 0.22f);
+        g.setColour(StudioStyle::Colours::buttonPlate);
+        g.fillRoundedRectangle(plateBounds, plateCorner);
     }
 
     float cornerRadiusPx { StudioStyle::Sizes::buttonCornerRadiusPx };
@@ -136,8 +153,10 @@ private:
     // Slightly "reddish" outline for muted tracks.
     juce::Colour mutedOutline { StudioStyle::Colours::accent.darker(0.05f) };
 
-    std::unique_ptr<juce::Drawable> offDrawable;
-    std::unique_ptr<juce::Drawable> onDrawable;
+    CachedBackdrop backdrop;
+    juce::SharedResourcePointer<SvgArtworkCache> artworkCache;
+    SvgArtworkCache::Asset offArtwork;
+    SvgArtworkCache::Asset onArtwork;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackSelectorButton)
 };
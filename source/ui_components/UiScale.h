@@ -0,0 +1,72 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+// Editor scale for native-resolution layout. The editor lays its components out at the window's
+// real size (no scaling transform) and records the factor relative to the 750x500 design on its
+// content root. Components that lay out or draw with fixed design-pixel sizes (child bounds, fonts,
+// outlines, corner radii, ring widths) multiply them by UiScale::of(*this) in their own resized()
+// and paint(), so everything renders on the untransformed path and cached images stay pixel-exact.
+namespace UiScale
+{
+    inline const juce::Identifier property { "modelCyclesUiScale" };
+
+    // Message thread.
+    inline void set(juce::Component& root, float scale)
+    {
+        root.getProperties().set(property, scale);
+    }
+
+    // 1.0 for components outside an editor (e.g. popup menus, offscreen snapshots).
+    inline float of(const juce::Component& component)
+    {
+        for (auto* c = &component; c != nullptr; c = c->getParentComponent())
+            if (const auto* value = c->getProperties().getVarPointer(property))
+                return (float) *value;
+
+        return 1.0f;
+    }
+}
+
+// Popup menus open in their own desktop window, so UiScale::of() can't reach the editor from a
+// LookAndFeel's popup methods. LookAndFeels that draw popups derive from this instead of
+// LookAndFeel_V4: each item is measured and drawn with popupScale set to the scale of the menu's
+// target component (a ComboBox's popup targets the box; other menus pass withTargetComponent).
+class PopupScaledLookAndFeel : public juce::LookAndFeel_V4
+{
+public:
+    void getIdealPopupMenuItemSizeWithOptions(const juce::String& text, bool isSeparator, int standardMenuItemHeight,
+                                              int& idealWidth, int& idealHeight,
+                                              const juce::PopupMenu::Options& options) override
+    {
+        popupScale = scaleOf(options);
+        juce::LookAndFeel_V4::getIdealPopupMenuItemSizeWithOptions(text, isSeparator, standardMenuItemHeight,
+                                                                   idealWidth, idealHeight, options);
+    }
+
+    void drawPopupMenuItemWithOptions(juce::Graphics& g, const juce::Rectangle<int>& area, bool isHighlighted,
+                                      const juce::PopupMenu::Item& item,
+                                      const juce::PopupMenu::Options& options) override
+    {
+        popupScale = scaleOf(options);
+        juce::LookAndFeel_V4::drawPopupMenuItemWithOptions(g, area, isHighlighted, item, options);
+    }
+
+protected:
+    // Design pixels to popup pixels.
+    int popupPx(float designPx) const
+    {
+        return juce::roundToInt(designPx * popupScale);
+    }
+
+    float popupScale { 1.0f };
+
+private:
+    static float scaleOf(const juce::PopupMenu::Options& options)
+    {
+        if (auto* target = options.getTargetComponent())
+            return UiScale::of(*target);
+
+        return 1.0f;
+    }
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// Dial value text, shared by every dial in every editor (hold it in a juce::SharedResourcePointer).
+// Texts are interned, so dials showing the same value share one immutable string, and each
+// (text, font, box) is shaped into a GlyphArrangement once; drawing a value is then a glyph blit
+// with no string formatting, allocation or text layout. Pairs with ValueTextTable, which keeps
+// each slider's texts per value position.
+class ValueTextCache final
+{
+public:
+    static constexpr size_t maxArrangements = 4096;
+
+    ValueTextCache() = default;
+
+    // Message thread.
+    juce::String intern(const juce::String& text)
+    {
+        return pool.getPooledString(text);
+    }
+
+    // Message thread. Same output as Graphics::drawFittedText(text, area, justification, 1) with
+    // `font`. `text` must come from intern(): arrangements are keyed by its string buffer.
+    void drawFittedText(juce::Graphics& g, const juce::String& text, const juce::Font& font,
+                        juce::Rectangle<int> area, juce::Justification justification)
+    {
+        if (text.isEmpty() || area.isEmpty())
+            return;
+
+        if (arrangements.size() > maxArrangements)
+            arrangements.clear();
+
+        Key key;
+        key.text = text;
+        key.typefaceName = font.getTypefaceName();
+        key.styleFlags = font.getStyleFlags();
+        key.height = font.getHeight();
+        key.horizontalScale = font.getHorizontalScale();
+        key.width = area.getWidth();
+        key.boxHeight = area.getHeight();
+        key.justification = justification.getFlags();
+
+        auto [it, inserted] = arrangements.try_emplace(key);
+        if (inserted)
+            it->second.addFittedText(font, text, 0.0f, 0.0f, (float) area.getWidth(), (float) area.getHeight(),
+                                     justification, 1);
+
+        it->second.draw(g, juce::AffineTransform::translation((float) area.getX(), (float) area.getY()));
+    }
+
+private:
+    struct Key
+    {
+        juce::String text; // interned: equal texts share a buffer, and holding it keeps it pooled
+        juce::String typefaceName;
+        int styleFlags { 0 };
+        float height { 0.0f };
+        float horizontalScale { 1.0f };
+        int width { 0 };
+        int boxHeight { 0 };
+        int justification { 0 };
+
+        bool operator==(const Key& o) const
+        {
+            return text.getCharPointer() == o.text.getCharPointer() && typefaceName == o.typefaceName
+                && styleFlags == o.styleFlags && height == o.height && horizontalScale == o.horizontalScale
+                && width == o.width && boxHeight == o.boxHeight && justification == o.justification;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& k) const noexcept
+        {
+            size_t h = 0;
+            const auto mix = [&h] (size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+
+            mix(std::hash<const void*>()(k.text.getCharPointer().getAddress()));
+            mix((size_t) k.typefaceName.hash());
+            mix((size_t) k.styleFlags);
+            mix(std::hash<float>()(k.height));
+            mix(std::hash<float>()(k.horizontalScale));
+            mix((size_t) k.width);
+            mix((size_t) k.boxHeight);
+            mix((size_t) k.justification);
+            return h;
+        }
+    };
+
+    juce::StringPool pool;
+    std::unordered_map<Key, juce::GlyphArrangement, KeyHash> arrangements;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ValueTextCache)
+};
+
+// One slider's value texts, one interned string per value position. Only small stepped ranges
+// are tabulated (0..127, -64..63, the 14 delay sync steps, ...); each text is formatted with the
+// slider's own getTextFromValue() the first time that value is shown. The table follows the
+// slider's range and decimal places; call invalidate() after replacing textFromValueFunction on
+// a slider that has already been painted.
+class ValueTextTable final
+{
+public:
+    static constexpr int maxEntries = 256;
+
+    ValueTextTable() = default;
+
+    void invalidate() noexcept
+    {
+        valid = false;
+    }
+
+    // Message thread. The interned text for `value`, or nullptr if it isn't on a tabulated step
+    // (the caller formats it itself).
+    const juce::String* find(juce::Slider& slider, double value)
+    {
+        const double start = slider.getMinimum();
+        const double end = slider.getMaximum();
+        const double step = slider.getInterval();
+        const int decimals = slider.getNumDecimalPlacesToDisplay();
+
+        if (! valid || start != rangeStart || end != rangeEnd || step != interval || decimals != decimalPlaces)
+        {
+            texts.clear();
+            filled.clear();
+            numEntries = 0;
+
+            valid = true;
+            rangeStart = start;
+            rangeEnd = end;
+            interval = step;
+            decimalPlaces = decimals;
+
+            if (step > 0.0 && (end - start) / step < (double) maxEntries)
+                numEntries = (int) std::lround((end - start) / step) + 1;
+        }
+
+        if (numEntries == 0)
+            return nullptr;
+
+        const int index = (int) std::lround((value - start) / step);
+        if (index < 0 || index >= numEntries || std::abs(start + (double) index * step - value) > step * 1.0e-6)
+            return nullptr;
+
+        if (texts.empty())
+        {
+            texts.resize((size_t) numEntries);
+            filled.resize((size_t) numEntries, 0);
+        }
+
+        auto& text = texts[(size_t) index];
+        if (filled[(size_t) index] == 0)
+        {
+            text = cache->intern(slider.getTextFromValue(start + (double) index * step));
+            filled[(size_t) index] = 1;
+        }
+
+        return &text;
+    }
+
+private:
+    juce::SharedResourcePointer<ValueTextCache> cache;
+    std::vector<juce::String> texts;
+    std::vector<juce::uint8> filled;
+    int numEntries { 0 };
+
+    double rangeStart { 0.0 };
+    double rangeEnd { 0.0 };
+    double interval { 0.0 };
+    int decimalPlaces { 0 };
+    bool valid { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ValueTextTable)
+};